@@ -0,0 +1,118 @@
+#include "Animation.h"
+#include <iostream>
+
+bool AnimationTable::defineStrip(int clipId, SDL_Texture* texture, int stripFrames, Uint32 frameDuration,
+                                 ClipPlayback playback, int nextClip, int firstFrame, int usedFrames) {
+    AtlasRegion strip = { texture, { 0, 0, 0, 0 }, false, { 0, 0 }, false };
+    if (texture) {
+        SDL_QueryTexture(texture, NULL, NULL, &strip.rect.w, &strip.rect.h);
+    }
+    return defineStrip(clipId, strip, stripFrames, frameDuration, playback, nextClip, firstFrame, usedFrames);
+}
+
+bool AnimationTable::defineStrip(int clipId, const AtlasRegion& strip, int stripFrames, Uint32 frameDuration,
+                                 ClipPlayback playback, int nextClip, int firstFrame, int usedFrames) {
+    if (clipId < 0 || !strip.texture || stripFrames <= 0) {
+        std::cout << "Invalid animation clip definition for clip " << clipId << std::endl;
+        return false;
+    }
+
+    SDL_Texture* texture = strip.texture;
+    int frameWidth = strip.rect.w / stripFrames;
+    int height = strip.rect.h;
+
+    if (usedFrames < 0) usedFrames = stripFrames - firstFrame;
+    if (firstFrame < 0 || usedFrames <= 0 || firstFrame + usedFrames > stripFrames) {
+        std::cout << "Animation clip " << clipId << " frame range is out of the strip" << std::endl;
+        return false;
+    }
+
+    if (clipId >= static_cast<int>(clips.size())) {
+        clips.resize(clipId + 1, AnimationClip{nullptr, {}, 0, CLIP_LOOP, -1, false, {0, 0}, false, 0, 0});
+    }
+
+    AnimationClip& clip = clips[clipId];
+    clip.texture = texture;
+    clip.frameDuration = frameDuration > 0 ? frameDuration : 1;
+    clip.playback = playback;
+    clip.nextClip = nextClip;
+    clip.hasFlash = strip.hasFlash;
+    clip.flashOffset = strip.flashOffset;
+    clip.hasMirror = strip.hasMirror;
+    clip.mirrorEdges = strip.rect.x * 2 + strip.rect.w;
+    clip.mirrorOffsetY = strip.rect.h;
+    clip.frames.clear();
+    for (int i = 0; i < usedFrames; i++) {
+        clip.frames.push_back({ strip.rect.x + (firstFrame + i) * frameWidth, strip.rect.y, frameWidth, height });
+    }
+    return true;
+}
+
+void AnimationTable::defineAlias(int clipId, int sourceClipId) {
+    if (clipId < 0 || !hasClip(sourceClipId)) return;
+    if (clipId >= static_cast<int>(clips.size())) {
+        clips.resize(clipId + 1, AnimationClip{nullptr, {}, 0, CLIP_LOOP, -1, false, {0, 0}, false, 0, 0});
+    }
+    clips[clipId] = clips[sourceClipId];
+}
+
+bool AnimationTable::hasClip(int clipId) const {
+    return clipId >= 0 && clipId < static_cast<int>(clips.size()) && !clips[clipId].frames.empty();
+}
+
+void AnimationTable::play(AnimationCursor& cursor, int clipId, Uint32 now, bool restart) {
+    if (cursor.clip == clipId && !restart) return;
+    cursor.clip = clipId;
+    cursor.startTime = now;
+}
+
+int AnimationTable::advance(AnimationCursor& cursor, Uint32 now) const {
+    if (!hasClip(cursor.clip)) return 0;
+
+    const AnimationClip* clip = &clips[cursor.clip];
+    Uint32 frame = (now - cursor.startTime) / clip->frameDuration;
+
+    // Hand finished one-shot clips over to their follow-up clip
+    while (frame >= clip->frames.size() && clip->playback == CLIP_ONCE && hasClip(clip->nextClip)) {
+        cursor.startTime += clip->length();
+        cursor.clip = clip->nextClip;
+        clip = &clips[cursor.clip];
+        frame = (now - cursor.startTime) / clip->frameDuration;
+    }
+
+    Uint32 count = static_cast<Uint32>(clip->frames.size());
+    if (clip->playback == CLIP_LOOP) return static_cast<int>(frame % count);
+    return static_cast<int>(frame < count ? frame : count - 1);
+}
+
+void AnimationTable::submitFrame(RenderLayer layer, const AnimationClip& clip, const SDL_Rect& frame,
+                                 const SDL_Rect& dest, SDL_RendererFlip flip, bool flashing, Uint8 flashAlpha) {
+    RenderQueue& queue = RenderQueue::getInstance();
+
+    // Swap in the mirrored frame instead of flipping at draw time
+    SDL_Rect source = frame;
+    if (clip.hasMirror && (flip & SDL_FLIP_HORIZONTAL)) {
+        source.x = clip.mirrorEdges - (frame.x + frame.w);
+        source.y = frame.y + clip.mirrorOffsetY;
+        flip = static_cast<SDL_RendererFlip>(flip & ~SDL_FLIP_HORIZONTAL);
+    }
+
+    if (flashing && !clip.hasFlash) {
+        // No flash copy (separate texture): draw the sprite additively instead
+        queue.submit(layer, clip.texture, &source, dest, flip, SDL_Color{ 255, 255, 255, flashAlpha }, SDL_BLENDMODE_ADD);
+        return;
+    }
+
+    queue.submit(layer, clip.texture, &source, dest, flip);
+    if (flashing) {
+        SDL_Rect flashFrame = { source.x + clip.flashOffset.x, source.y + clip.flashOffset.y, source.w, source.h };
+        queue.submit(layer, clip.texture, &flashFrame, dest, flip, SDL_Color{ 255, 255, 255, flashAlpha });
+    }
+}
+
+bool AnimationTable::isFinished(const AnimationCursor& cursor, Uint32 now) const {
+    if (!hasClip(cursor.clip)) return true;
+    const AnimationClip& clip = clips[cursor.clip];
+    if (clip.playback == CLIP_LOOP) return false;
+    return (now - cursor.startTime) / clip.frameDuration >= clip.frames.size() - 1;
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include <SDL.h>
+#include <vector>
+#include "TextureAtlas.h"
+#include "RenderQueue.h"
+
+// How a clip behaves once it reaches its last frame
+enum ClipPlayback {
+    CLIP_LOOP,  // Wrap around to the first frame
+    CLIP_ONCE   // Stop on the last frame, then switch to nextClip if one is set
+};
+
+// One animation clip: a texture plus its precomputed frame rectangles
+struct AnimationClip {
+    SDL_Texture* texture;
+    std::vector<SDL_Rect> frames;
+    Uint32 frameDuration;   // Milliseconds per frame
+    ClipPlayback playback;
+    int nextClip;           // Clip to play after a CLIP_ONCE clip ends (-1 = hold last frame)
+    bool hasFlash;          // Frames have a white flash copy on the same texture
+    SDL_Point flashOffset;  // Offset from a frame to its flash copy
+    bool hasMirror;         // Frames have a mirrored copy on the same texture
+    int mirrorEdges;        // Left + right edge of the strip: mirrored frame x = mirrorEdges - frame right edge
+    int mirrorOffsetY;      // Offset from a frame to its mirrored copy
+
+    int frameCount() const { return static_cast<int>(frames.size()); }
+    Uint32 length() const { return frameDuration * static_cast<Uint32>(frames.size()); }
+};
+
+// Per-entity animation state: the clip being played and when it started
+struct AnimationCursor {
+    int clip;
+    Uint32 startTime;
+};
+
+// Table of clips built once at load time, indexed by clip id.
+// Entities use their animation state enum as the clip id.
+class AnimationTable {
+public:
+    // Define clipId from a horizontal strip of stripFrames equally sized frames.
+    // Only frames [firstFrame, firstFrame + usedFrames) are used (-1 = the rest of the strip).
+    bool defineStrip(int clipId, SDL_Texture* texture, int stripFrames, Uint32 frameDuration,
+                     ClipPlayback playback, int nextClip = -1, int firstFrame = 0, int usedFrames = -1);
+    // Same, for a strip stored in a region of a texture (e.g. an atlas page)
+    bool defineStrip(int clipId, const AtlasRegion& strip, int stripFrames, Uint32 frameDuration,
+                     ClipPlayback playback, int nextClip = -1, int firstFrame = 0, int usedFrames = -1);
+
+    // Reuse an already defined clip under another id
+    void defineAlias(int clipId, int sourceClipId);
+
+    bool hasClip(int clipId) const;
+    const AnimationClip& getClip(int clipId) const { return clips[clipId]; }
+
+    // Start clipId on the cursor; keeps the running clip unless restart is set
+    static void play(AnimationCursor& cursor, int clipId, Uint32 now, bool restart = false);
+
+    // Resolve the cursor at time now: follows nextClip hand-offs and returns the frame index
+    int advance(AnimationCursor& cursor, Uint32 now) const;
+
+    // True once a CLIP_ONCE clip without a follow-up is showing its last frame
+    bool isFinished(const AnimationCursor& cursor, Uint32 now) const;
+
+    // Queue one frame of clip. Horizontal flips use the pre-mirrored frame when there is one.
+    // While flashing, the white flash copy is drawn over it with flashAlpha as vertex
+    // alpha, so it stays in the same batch as other sprites.
+    static void submitFrame(RenderLayer layer, const AnimationClip& clip, const SDL_Rect& frame,
+                            const SDL_Rect& dest, SDL_RendererFlip flip, bool flashing, Uint8 flashAlpha);
+
+private:
+    std::vector<AnimationClip> clips;
+};
@@ -0,0 +1,227 @@
+#include "AssetLoader.h"
+#include "AssetPack.h"
+#include "TextureCache.h"
+#include "AudioManager.h"
+#include "TextureManager.h"
+#include "Game.hpp"
+#include <algorithm>
+#include <iostream>
+
+AssetLoader& AssetLoader::getInstance() {
+    static AssetLoader instance;
+    return instance;
+}
+
+AssetLoader::AssetLoader()
+    : started(false), mutex(SDL_CreateMutex()), jobReady(SDL_CreateCond()), cancelled(false),
+      queuedCount(0), finishedCount(0) { }
+
+AssetLoader::~AssetLoader() {
+    stopWorkers();
+    if (jobReady) SDL_DestroyCond(jobReady);
+    if (mutex) SDL_DestroyMutex(mutex);
+}
+
+void AssetLoader::queue(const char* path, AssetKind kind) {
+    // Music is handed over for one playMusic and may be prefetched again after that
+    if (inFlight.count(path) != 0) return;
+    if (kind != ASSET_MUSIC && !requested.insert(path).second) return;
+    inFlight.insert(path);
+    queuedCount++;
+
+    SDL_LockMutex(mutex);
+    pending.push_back(Job{ path, kind, nullptr, nullptr, nullptr });
+    SDL_CondSignal(jobReady);
+    SDL_UnlockMutex(mutex);
+
+    if (started && workers.empty()) decodePending();
+}
+
+bool AssetLoader::start() {
+    if (!mutex || !jobReady) {
+        std::cout << "Failed to create asset loader lock. Error: " << SDL_GetError() << std::endl;
+        return false;
+    }
+    if (started) return true;
+    started = true;
+
+    // Leave a core for the main thread, which keeps drawing and uploading
+    int count = std::min(std::max(SDL_GetCPUCount() - 1, 1), MAX_WORKERS);
+    for (int i = 0; i < count; i++) {
+        SDL_Thread* thread = SDL_CreateThread(workerMain, "AssetLoader", this);
+        if (!thread) {
+            std::cout << "Failed to start asset loader thread. Error: " << SDL_GetError() << std::endl;
+            break;
+        }
+        workers.push_back(thread);
+    }
+
+    // No threads at all: decode right here, update() still hands everything over
+    if (workers.empty()) decodePending();
+    return true;
+}
+
+int AssetLoader::workerMain(void* data) {
+    AssetLoader* loader = static_cast<AssetLoader*>(data);
+    SDL_LockMutex(loader->mutex);
+    while (true) {
+        while (!loader->cancelled && loader->pending.empty()) {
+            SDL_CondWait(loader->jobReady, loader->mutex);
+        }
+        if (loader->cancelled) break;
+
+        Job job = loader->pending.front();
+        loader->pending.pop_front();
+        SDL_UnlockMutex(loader->mutex);
+
+        decode(job);
+
+        SDL_LockMutex(loader->mutex);
+        loader->done.push_back(job);
+    }
+    SDL_UnlockMutex(loader->mutex);
+    return 0;
+}
+
+void AssetLoader::decodePending() {
+    SDL_LockMutex(mutex);
+    while (!pending.empty()) {
+        Job job = pending.front();
+        pending.pop_front();
+        decode(job);
+        done.push_back(job);
+    }
+    SDL_UnlockMutex(mutex);
+}
+
+void AssetLoader::decode(Job& job) {
+    if (job.kind == ASSET_MUSIC) {
+        // Only opens the stream; the mixer decodes it as it plays
+        job.music = Mix_LoadMUS_RW(AssetPack::getInstance().openAsset(job.path.c_str()), 1);
+        if (!job.music) {
+            std::cout << "Failed to load music: " << job.path << ". Error: " << Mix_GetError() << std::endl;
+        }
+        return;
+    }
+    if (job.kind == ASSET_SOUND) {
+        job.chunk = Mix_LoadWAV_RW(AssetPack::getInstance().openAsset(job.path.c_str()), 1);
+        if (!job.chunk) {
+            std::cout << "Failed to load sound effect: " << job.path << ". Error: " << Mix_GetError() << std::endl;
+        }
+        return;
+    }
+
+    // Atlas sheets are packed as RGBA32, textures are uploaded in the renderer's own format;
+    // either way the pixels come out of the texture cache ready to use when it is warm
+    Uint32 format = job.kind == ASSET_SURFACE ? Uint32(SDL_PIXELFORMAT_RGBA32) : TextureCache::getNativeFormat();
+    job.surface = TextureCache::loadImage(job.path.c_str(), format);
+}
+
+bool AssetLoader::update() {
+    if (inFlight.empty()) return true;
+
+    std::vector<Job> finished;
+    SDL_LockMutex(mutex);
+    finished.swap(done);
+    SDL_UnlockMutex(mutex);
+
+    // Textures can only be created on the render thread
+    for (Job& job : finished) {
+        if (job.kind == ASSET_MUSIC) {
+            if (job.music) AudioManager::getInstance().addMusic(job.path.c_str(), job.music);
+        } else if (job.kind == ASSET_SOUND) {
+            if (job.chunk) AudioManager::getInstance().addSoundEffect(job.path.c_str(), job.chunk);
+        } else if (job.surface && job.kind == ASSET_TEXTURE) {
+            SDL_Texture* texture = SDL_CreateTextureFromSurface(Game::renderer, job.surface);
+            if (texture) {
+                textures[job.path] = texture;
+            } else {
+                std::cout << "Failed to create texture from surface. Error: " << SDL_GetError() << std::endl;
+            }
+            SDL_FreeSurface(job.surface);
+        } else if (job.surface) {
+            surfaces[job.path] = job.surface;
+        }
+        inFlight.erase(job.path);
+        finishedCount++;
+    }
+    return inFlight.empty();
+}
+
+float AssetLoader::getProgress() const {
+    return queuedCount == 0 ? 1.0f : static_cast<float>(finishedCount) / queuedCount;
+}
+
+void AssetLoader::finish(const char* path) {
+    while (isPending(path)) {
+        if (workers.empty()) decodePending();
+        if (!update()) SDL_Delay(1);
+    }
+}
+
+SDL_Texture* AssetLoader::takeTexture(const char* path) {
+    auto it = textures.find(path);
+    if (it == textures.end()) return nullptr;
+    SDL_Texture* texture = it->second;
+    textures.erase(it);
+    return texture;
+}
+
+SDL_Surface* AssetLoader::takeSurface(const char* path) {
+    auto it = surfaces.find(path);
+    if (it == surfaces.end()) return nullptr;
+    SDL_Surface* surface = it->second;
+    surfaces.erase(it);
+    return surface;
+}
+
+void AssetLoader::stopWorkers() {
+    if (mutex) {
+        SDL_LockMutex(mutex);
+        cancelled = true;
+        if (jobReady) SDL_CondBroadcast(jobReady);
+        SDL_UnlockMutex(mutex);
+    }
+    for (SDL_Thread* thread : workers) {
+        SDL_WaitThread(thread, nullptr);
+    }
+    workers.clear();
+}
+
+void AssetLoader::clear() {
+    stopWorkers();
+
+    // Results decoded but never handed over (quit while loading)
+    for (Job& job : done) {
+        if (job.surface) SDL_FreeSurface(job.surface);
+        if (job.chunk) Mix_FreeChunk(job.chunk);
+        if (job.music) Mix_FreeMusic(job.music);
+    }
+    done.clear();
+    pending.clear();
+    requested.clear();
+    inFlight.clear();
+    queuedCount = 0;
+    finishedCount = 0;
+    started = false;
+    cancelled = false;
+
+    for (auto& entry : textures) SDL_DestroyTexture(entry.second);
+    textures.clear();
+    for (auto& entry : surfaces) SDL_FreeSurface(entry.second);
+    surfaces.clear();
+}
+
+void TextureHandle::prefetch() {
+    if (!texture && !failed) AssetLoader::getInstance().queue(path, ASSET_TEXTURE);
+}
+
+SDL_Texture* TextureHandle::get() {
+    if (!texture && !failed) {
+        // A prefetch still decoding: wait for it rather than decode the file twice
+        AssetLoader::getInstance().finish(path);
+        texture = TextureManager::loadTexture(path);
+        failed = texture == nullptr;
+    }
+    return texture;
+}
@@ -0,0 +1,109 @@
+#pragma once
+#include <SDL.h>
+#include <SDL_mixer.h>
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// What a queued asset is decoded into
+enum AssetKind {
+    ASSET_TEXTURE,  // Decoded on a worker, uploaded to a texture on the render thread
+    ASSET_SURFACE,  // Decoded to an RGBA32 surface and kept as is (atlas sheets)
+    ASSET_SOUND,    // Decoded sound effect, handed to AudioManager
+    ASSET_MUSIC     // Opened music stream, handed to AudioManager (may be queued again once taken)
+};
+
+// Singleton background loader: decodes images and sounds on worker threads
+// while the main thread keeps drawing. update() hands finished results over
+// on the main thread, uploading textures as they arrive. It loads the startup
+// set behind the loading screen, then stays up for prefetches during play.
+// TextureManager, TextureAtlas and AudioManager take the preloaded results by
+// path and only fall back to loading from disk for assets that weren't queued.
+class AssetLoader {
+public:
+    static AssetLoader& getInstance();
+
+    // Queue an asset for the workers; paths in flight or already loaded are skipped
+    void queue(const char* path, AssetKind kind);
+
+    // Spawn the worker threads; assets queued before this start decoding now
+    bool start();
+
+    // Main thread, once per frame: hand over everything finished since the last call.
+    // Returns true when nothing queued is still in flight.
+    bool update();
+
+    // Fraction of queued assets handed over, 0 to 1
+    float getProgress() const;
+
+    // True while path is queued or decoding
+    bool isPending(const char* path) const { return inFlight.count(path) != 0; }
+    // Block until an in-flight path has been handed over (no-op if it isn't queued)
+    void finish(const char* path);
+
+    // Take ownership of a preloaded texture or surface (nullptr if it wasn't preloaded)
+    SDL_Texture* takeTexture(const char* path);
+    SDL_Surface* takeSurface(const char* path);
+
+    // Stop the workers and free anything that was never taken
+    void clear();
+
+private:
+    AssetLoader();
+    ~AssetLoader();
+    AssetLoader(const AssetLoader&) = delete;
+    AssetLoader& operator=(const AssetLoader&) = delete;
+
+    struct Job {
+        std::string path;
+        AssetKind kind;
+        SDL_Surface* surface;
+        Mix_Chunk* chunk;
+        Mix_Music* music;
+    };
+
+    static int workerMain(void* data);
+    // Worker side: decode one job without touching the renderer
+    static void decode(Job& job);
+    // No worker threads: decode the pending jobs right here
+    void decodePending();
+    void stopWorkers();
+
+    std::vector<SDL_Thread*> workers;
+    bool started;
+    SDL_mutex* mutex;              // Guards pending, done and cancelled
+    SDL_cond* jobReady;
+    std::deque<Job> pending;       // Waiting for a worker
+    std::vector<Job> done;         // Decoded, not yet handed over
+    bool cancelled;
+
+    // Main thread only
+    std::unordered_set<std::string> requested;  // Every path ever queued, except music
+    std::unordered_set<std::string> inFlight;   // Queued and not yet handed over
+    size_t queuedCount;
+    size_t finishedCount;
+    std::unordered_map<std::string, SDL_Texture*> textures;
+    std::unordered_map<std::string, SDL_Surface*> surfaces;
+
+    static const int MAX_WORKERS = 4;
+};
+
+// Texture that is only loaded when first used. prefetch() starts decoding it
+// in the background ahead of time; get() loads it on the spot if that hasn't
+// happened. The texture belongs to TextureManager like any other.
+class TextureHandle {
+public:
+    explicit TextureHandle(const char* path) : path(path), texture(nullptr), failed(false) { }
+
+    void prefetch();
+    // The texture, loading it now if needed (nullptr if it failed to load)
+    SDL_Texture* get();
+    bool isLoaded() const { return texture != nullptr; }
+
+private:
+    const char* path;
+    SDL_Texture* texture;
+    bool failed;  // Don't retry a missing file every frame
+};
@@ -0,0 +1,135 @@
+#include "AssetPack.h"
+#include "PackFormat.h"
+#include <cstring>
+#include <iostream>
+
+AssetPack& AssetPack::getInstance() {
+    static AssetPack instance;
+    return instance;
+}
+
+AssetPack::AssetPack() : mutex(SDL_CreateMutex()) { }
+
+AssetPack::~AssetPack() {
+    if (mutex) SDL_DestroyMutex(mutex);
+}
+
+bool AssetPack::open(const char* path) {
+    close();
+    if (!file.open(path)) return false;
+
+    const char* data = file.getData();
+    size_t size = file.getSize();
+
+    PackFormat::PackHeader header;
+    if (size < sizeof(header) || std::memcmp(data, PackFormat::MAGIC, sizeof(PackFormat::MAGIC)) != 0) {
+        std::cout << "Not an asset pack: " << path << std::endl;
+        close();
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(header));
+    if (header.version != PackFormat::VERSION) {
+        std::cout << "Unsupported asset pack version " << header.version << ": " << path << std::endl;
+        close();
+        return false;
+    }
+
+    // Table of contents and name table must fit in the file
+    size_t tocOffset = sizeof(header);
+    size_t namesOffset = tocOffset + static_cast<size_t>(header.entryCount) * sizeof(PackFormat::PackEntry);
+    if (header.entryCount > size / sizeof(PackFormat::PackEntry) || namesOffset + header.nameTableSize > size) {
+        std::cout << "Corrupt asset pack table: " << path << std::endl;
+        close();
+        return false;
+    }
+
+    for (Uint32 i = 0; i < header.entryCount; i++) {
+        PackFormat::PackEntry packed;
+        std::memcpy(&packed, data + tocOffset + i * sizeof(packed), sizeof(packed));
+
+        bool validName = static_cast<size_t>(packed.nameOffset) + packed.nameLength <= header.nameTableSize;
+        bool validData = packed.offset <= size && packed.storedSize <= size - packed.offset;
+        bool validCompression = packed.compression == PackFormat::COMPRESSION_NONE
+            ? packed.storedSize == packed.size
+            : packed.compression == PackFormat::COMPRESSION_LZ4;
+        if (!validName || !validData || !validCompression) {
+            std::cout << "Corrupt asset pack entry " << i << ": " << path << std::endl;
+            close();
+            return false;
+        }
+
+        std::string name(data + namesOffset + packed.nameOffset, packed.nameLength);
+        Entry& entry = entries[name];
+        entry.stored = data + packed.offset;
+        entry.storedSize = static_cast<size_t>(packed.storedSize);
+        entry.size = static_cast<size_t>(packed.size);
+        entry.compression = packed.compression;
+    }
+
+    this->path = path;
+    std::cout << "Asset pack " << path << ": " << entries.size() << " files" << std::endl;
+    return true;
+}
+
+void AssetPack::close() {
+    entries.clear();
+    path.clear();
+    file.close();
+}
+
+std::string AssetPack::normalize(const char* path) {
+    std::string name(path);
+    for (char& c : name) {
+        if (c == '\\') c = '/';
+    }
+    if (name.compare(0, 2, "./") == 0) name.erase(0, 2);
+    return name;
+}
+
+bool AssetPack::getSize(const char* name, size_t& size) const {
+    if (entries.empty()) return false;
+
+    auto it = entries.find(normalize(name));
+    if (it == entries.end()) return false;
+    size = it->second.size;
+    return true;
+}
+
+bool AssetPack::find(const char* name, const char*& data, size_t& size) {
+    if (entries.empty()) return false;
+
+    auto it = entries.find(normalize(name));
+    if (it == entries.end()) return false;
+    Entry& entry = it->second;
+
+    if (entry.compression == PackFormat::COMPRESSION_NONE) {
+        data = entry.stored;
+        size = entry.size;
+        return true;
+    }
+
+    // Two threads may ask for the same compressed file; only one unpacks it
+    SDL_LockMutex(mutex);
+    if (!entry.unpacked) {
+        std::unique_ptr<char[]> unpacked(new char[entry.size > 0 ? entry.size : 1]);
+        if (!PackFormat::decompressLz4(entry.stored, entry.storedSize, unpacked.get(), entry.size)) {
+            std::cout << "Corrupt packed file: " << name << std::endl;
+            SDL_UnlockMutex(mutex);
+            return false;
+        }
+        entry.unpacked = std::move(unpacked);
+    }
+    SDL_UnlockMutex(mutex);
+    data = entry.unpacked.get();
+    size = entry.size;
+    return true;
+}
+
+SDL_RWops* AssetPack::openAsset(const char* path) {
+    const char* data;
+    size_t size;
+    if (find(path, data, size)) {
+        return SDL_RWFromConstMem(data, static_cast<int>(size));
+    }
+    return SDL_RWFromFile(path, "rb");
+}
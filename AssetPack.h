@@ -0,0 +1,53 @@
+#pragma once
+#include <SDL.h>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include "MappedFile.h"
+
+// Singleton view of the asset pack (data.pak, built by tools/assetpack).
+// The pack is memory-mapped once; stored entries are read straight from the
+// mapping and compressed ones are unpacked on first use and kept.
+// Paths not in the pack (or no pack at all) fall back to loose files.
+// Lookups are safe from the asset loader's worker threads.
+class AssetPack {
+public:
+    static AssetPack& getInstance();
+
+    // Map a pack file; false (and loose files are used) if it is missing or invalid
+    bool open(const char* path);
+    void close();
+    bool isOpen() const { return file.isOpen(); }
+
+    // Contents of a packed file by its relative path, e.g. "assets/Idle.png"
+    bool find(const char* name, const char*& data, size_t& size);
+    // Unpacked size of a packed file, without unpacking it
+    bool getSize(const char* name, size_t& size) const;
+    // Path the pack was opened from
+    const std::string& getPath() const { return path; }
+
+    // Read stream over the packed file, or the loose file if it isn't packed (nullptr if neither).
+    // The stream is meant to be handed to an SDL loader that frees it.
+    SDL_RWops* openAsset(const char* path);
+
+private:
+    AssetPack();
+    ~AssetPack();
+    AssetPack(const AssetPack&) = delete;
+    AssetPack& operator=(const AssetPack&) = delete;
+
+    struct Entry {
+        const char* stored;   // Points into the mapping
+        size_t storedSize;
+        size_t size;
+        Uint32 compression;
+        std::unique_ptr<char[]> unpacked;  // Compressed entries once decompressed
+    };
+
+    static std::string normalize(const char* path);
+
+    MappedFile file;
+    std::string path;
+    SDL_mutex* mutex;  // Guards the lazy unpacking in find()
+    std::unordered_map<std::string, Entry> entries;
+};
@@ -1,10 +1,15 @@
 #include "AudioManager.h"
+#include "AssetPack.h"
+#include "AssetLoader.h"
 #include <random>
 
 AudioManager* AudioManager::instance = nullptr;
+void* AudioManager::armedMusic = nullptr;
+SDL_atomic_t AudioManager::trackSwitched = { 0 };
 
-AudioManager::AudioManager() : backgroundMusic(nullptr), nextMusicPath(nullptr),
-    musicStartTime(0), waitingForNextTrack(false) {
+static const char* MISS_SOUND_PATH = "audio/11L-a_sword_swing_in_the-1744557232414.mp3";
+
+AudioManager::AudioManager() : backgroundMusic(nullptr), nextMusic(nullptr) {
     // Initialize random number generator
     std::random_device rd;
     rng.seed(rd());
@@ -50,30 +55,60 @@ bool AudioManager::init() {
         std::cout << "SDL_mixer could not initialize! SDL_mixer Error: " << Mix_GetError() << std::endl;
         return false;
     }
+    Mix_HookMusicFinished(onMusicFinished);
     return true;
 }
 
+// Audio thread, right after the last sample of the current track was mixed
+void SDLCALL AudioManager::onMusicFinished() {
+    // Take the armed track so a halt or a second call can't start it twice
+    Mix_Music* next = static_cast<Mix_Music*>(SDL_AtomicSetPtr(&armedMusic, nullptr));
+    if (next && Mix_PlayMusic(next, -1) == 0) {
+        SDL_AtomicSet(&trackSwitched, 1);
+    }
+}
+
 void AudioManager::playMusic(const char* path, int loops) {
     stopMusic(); // Stop any currently playing music
-    
-    backgroundMusic = Mix_LoadMUS(path);
+
+    // Opened in the background ahead of time if it was prefetched
+    AssetLoader::getInstance().finish(path);
+    auto prepared = preparedMusic.find(path);
+    if (prepared != preparedMusic.end()) {
+        backgroundMusic = prepared->second;
+        preparedMusic.erase(prepared);
+    } else {
+        // The music stream keeps reading from the pack while it plays
+        backgroundMusic = Mix_LoadMUS_RW(AssetPack::getInstance().openAsset(path), 1);
+    }
     if (backgroundMusic == nullptr) {
         std::cout << "Failed to load music! SDL_mixer Error: " << Mix_GetError() << std::endl;
         return;
     }
-    
-    musicStartTime = SDL_GetTicks();
+
+    musicPath = path;
+
     if (Mix_PlayMusic(backgroundMusic, loops) < 0) {
         std::cout << "Failed to play music! SDL_mixer Error: " << Mix_GetError() << std::endl;
     }
 }
 
 void AudioManager::stopMusic() {
+    // Disarm first so halting doesn't start the next track
+    SDL_AtomicSetPtr(&armedMusic, nullptr);
     if (backgroundMusic != nullptr) {
+        // Halting locks the audio thread, so a hook already switching tracks has finished by now
         Mix_HaltMusic();
+        applyTrackSwitch();
         Mix_FreeMusic(backgroundMusic);
         backgroundMusic = nullptr;
     }
+    musicPath.clear();
+    if (nextMusic != nullptr) {
+        Mix_FreeMusic(nextMusic);
+        nextMusic = nullptr;
+    }
+    nextMusicPath.clear();
 }
 
 void AudioManager::pauseMusic() {
@@ -93,14 +128,37 @@ void AudioManager::setMusicVolume(int volume) {
 }
 
 void AudioManager::playSoundEffect(const char* path) {
-    Mix_Chunk* effect = Mix_LoadWAV(path);
+    // A prefetch still decoding: let it land in the cache rather than decode the file twice
+    AssetLoader::getInstance().finish(path);
+
+    Mix_Chunk*& effect = soundEffects[path];
     if (!effect) {
-        std::cout << "Failed to load sound effect! SDL_mixer Error: " << Mix_GetError() << std::endl;
-        return;
+        effect = Mix_LoadWAV_RW(AssetPack::getInstance().openAsset(path), 1);
+        if (!effect) {
+            std::cout << "Failed to load sound effect! SDL_mixer Error: " << Mix_GetError() << std::endl;
+            soundEffects.erase(path);
+            return;
+        }
     }
     
     Mix_PlayChannel(-1, effect, 0);
-    soundEffects.push_back(effect); // Store for cleanup
+}
+
+void AudioManager::addSoundEffect(const char* path, Mix_Chunk* effect) {
+    Mix_Chunk*& slot = soundEffects[path];
+    if (slot) {
+        Mix_FreeChunk(effect);  // Already loaded on demand
+        return;
+    }
+    slot = effect;
+}
+
+std::vector<std::string> AudioManager::getEffectPaths() const {
+    std::vector<std::string> paths(hitSoundPaths);
+    paths.insert(paths.end(), parrySoundPaths.begin(), parrySoundPaths.end());
+    paths.insert(paths.end(), dashSoundPaths.begin(), dashSoundPaths.end());
+    paths.push_back(MISS_SOUND_PATH);
+    return paths;
 }
 
 void AudioManager::playRandomHitSound() {
@@ -112,7 +170,7 @@ void AudioManager::playRandomHitSound() {
 }
 
 void AudioManager::playMissSound() {
-    playSoundEffect("audio/11L-a_sword_swing_in_the-1744557232414.mp3");
+    playSoundEffect(MISS_SOUND_PATH);
 }
 
 void AudioManager::playRandomParrySound() {
@@ -134,27 +192,103 @@ void AudioManager::resumeAllSounds() {
 }
 
 void AudioManager::setNextTrack(const char* path) {
+    SDL_AtomicSetPtr(&armedMusic, nullptr);
+    if (nextMusic != nullptr) {
+        Mix_FreeMusic(nextMusic);
+        nextMusic = nullptr;
+    }
     nextMusicPath = path;
-    waitingForNextTrack = true;
+    prefetchMusic(path);
+}
+
+void AudioManager::prefetchMusic(const char* path) {
+    if (preparedMusic.count(path) == 0) {
+        AssetLoader::getInstance().queue(path, ASSET_MUSIC);
+    }
+}
+
+void AudioManager::addMusic(const char* path, Mix_Music* music) {
+    Mix_Music*& slot = preparedMusic[path];
+    if (slot) Mix_FreeMusic(slot);
+    slot = music;
+}
+
+void AudioManager::applyTrackSwitch() {
+    if (SDL_AtomicSet(&trackSwitched, 0) == 0) return;
+
+    // The finished track is halted by now; the armed one is what plays
+    if (backgroundMusic) Mix_FreeMusic(backgroundMusic);
+    backgroundMusic = nextMusic;
+    nextMusic = nullptr;
+    musicPath.swap(nextMusicPath);
+    nextMusicPath.clear();
+}
+
+void AudioManager::getMusicState(std::string& path, std::string& next, double& position) {
+    // A switch the audio thread already made counts as the current track
+    applyTrackSwitch();
+    path = musicPath;
+    next = nextMusicPath;
+    position = backgroundMusic ? Mix_GetMusicPosition(backgroundMusic) : 0.0;
+    if (position < 0.0) position = 0.0;  // Format can't report it; restart from the top
+}
+
+void AudioManager::restoreMusic(const char* path, const char* next, double position) {
+    if (!path || !*path) {
+        stopMusic();
+        return;
+    }
+
+    bool hasNext = next && *next;
+    playMusic(path, hasNext ? 1 : -1);
+    if (hasNext) setNextTrack(next);
+    if (backgroundMusic && position > 0.0 && Mix_SetMusicPosition(position) < 0) {
+        std::cout << "Failed to seek music! SDL_mixer Error: " << Mix_GetError() << std::endl;
+    }
 }
 
 void AudioManager::update() {
-    if (waitingForNextTrack && backgroundMusic) {
-        Uint32 currentTime = SDL_GetTicks();
-        if (currentTime - musicStartTime >= FIRST_TRACK_DURATION) {
-            playMusic(nextMusicPath);
-            waitingForNextTrack = false;
-            nextMusicPath = nullptr;
+    applyTrackSwitch();
+    if (nextMusicPath.empty()) return;
+
+    // Arm the next track for the finished hook once it has been opened
+    if (!nextMusic) {
+        auto prepared = preparedMusic.find(nextMusicPath);
+        if (prepared != preparedMusic.end()) {
+            nextMusic = prepared->second;
+            preparedMusic.erase(prepared);
+            SDL_AtomicSetPtr(&armedMusic, nextMusic);
+        }
+    }
+
+    // The current track ran out with nothing armed for the hook: start the next one late rather than never
+    if (backgroundMusic && !Mix_PlayingMusic()) {
+        SDL_AtomicSetPtr(&armedMusic, nullptr);  // Armed too late, the hook has already fired
+        if (nextMusic) {
+            Mix_FreeMusic(backgroundMusic);
+            backgroundMusic = nextMusic;
+            nextMusic = nullptr;
+            musicPath.swap(nextMusicPath);
+            nextMusicPath.clear();
+            Mix_PlayMusic(backgroundMusic, -1);
+        } else if (!AssetLoader::getInstance().isPending(nextMusicPath.c_str())) {
+            std::string path = nextMusicPath;  // The prefetch failed; playMusic clears nextMusicPath
+            playMusic(path.c_str());
         }
     }
 }
 
 void AudioManager::cleanup() {
     stopMusic();
+    Mix_HookMusicFinished(nullptr);
+    for (auto& entry : preparedMusic) {
+        Mix_FreeMusic(entry.second);
+    }
+    preparedMusic.clear();
     
     // Cleanup all sound effects
-    for (Mix_Chunk* effect : soundEffects) {
-        Mix_FreeChunk(effect);
+    for (auto& entry : soundEffects) {
+        Mix_FreeChunk(entry.second);
     }
     soundEffects.clear();
     
@@ -4,6 +4,7 @@
 #include <string>
 #include <iostream>
 #include <vector>
+#include <unordered_map>
 #include <random>
 
 // Singleton class to manage all game audio
@@ -18,10 +19,24 @@ public:
     void pauseMusic();
     void resumeMusic();
     void setMusicVolume(int volume); // 0-128
+    // Track to start the moment the current one ends (play that one with loops = 1).
+    // It is opened in the background and swapped in on the audio thread, without a gap.
     void setNextTrack(const char* path);
+    // Open a track on the asset loader's threads so a later playMusic doesn't stall
+    void prefetchMusic(const char* path);
+    // Hand over a track opened elsewhere (the asset loader); takes ownership
+    void addMusic(const char* path, Mix_Music* music);
+    // Track playing (empty when stopped), the track queued after it, and the position in seconds
+    void getMusicState(std::string& path, std::string& next, double& position);
+    // Play path from position seconds, with next queued after it if not empty (game-state snapshots)
+    void restoreMusic(const char* path, const char* next, double position);
     
     // Sound effect functions
     void playSoundEffect(const char* path);
+    // Hand over a sound effect decoded elsewhere (the startup loader); takes ownership
+    void addSoundEffect(const char* path, Mix_Chunk* effect);
+    // Every sound effect the random/miss helpers can play, for preloading
+    std::vector<std::string> getEffectPaths() const;
     void playRandomHitSound();
     void playRandomParrySound();
     void playRandomDashSound();
@@ -43,13 +58,22 @@ private:
 
     // Music properties
     Mix_Music* backgroundMusic;
-    const char* nextMusicPath;
-    Uint32 musicStartTime;
-    bool waitingForNextTrack;
-    static const Uint32 FIRST_TRACK_DURATION = 28000; // 28 seconds
+    std::string musicPath;      // Path backgroundMusic was opened from
+    std::string nextMusicPath;  // Empty if no track follows
+    Mix_Music* nextMusic;       // Opened next track, armed for the finished hook
+    // Tracks opened ahead of time, by path
+    std::unordered_map<std::string, Mix_Music*> preparedMusic;
+
+    // Shared with the audio thread: the track the finished hook should start, and whether it did
+    static void* armedMusic;
+    static SDL_atomic_t trackSwitched;
+    static void SDLCALL onMusicFinished();
+    // Adopt the next track as the current one once the hook has started it
+    void applyTrackSwitch();
     
     // Sound effect properties
-    std::vector<Mix_Chunk*> soundEffects;
+    // Decoded sound effects by path, each file is only loaded once
+    std::unordered_map<std::string, Mix_Chunk*> soundEffects;
     std::vector<std::string> hitSoundPaths;
     std::vector<std::string> parrySoundPaths;
     std::vector<std::string> dashSoundPaths;
@@ -1,5 +1,7 @@
 #include "Combat.hpp"
 #include "GameObject.h"
+#include "Enemy.h"
+#include "GameClock.h"
 #include <SDL.h>
 
 namespace Combat {
@@ -7,7 +9,8 @@ namespace Combat {
         // Only set attack state if player isn't already attacking
         if (!player->isAttacking) {
             player->isAttacking = true;
-            player->attackStartTime = SDL_GetTicks();
+            player->attackResolved = false;
+            player->attackStartTime = GameClock::getInstance().now();
             player->attackDuration = 300; // Attack animation duration in milliseconds
         }
     }
@@ -15,4 +18,59 @@ namespace Combat {
     void parry() {
         // Parry functionality is implemented directly in GameObject class
     }
+
+    void resolve(GameObject* player, const std::vector<Enemy*>& enemies, std::vector<CombatEvent>& events) {
+        if (!player) return;
+
+        SDL_Rect playerCollider = player->getCollider();
+        SDL_Rect playerAttackBox = player->getAttackHitbox();
+        bool playerSwinging = player->isAttacking;
+        bool swingConnected = false;
+
+        for (Enemy* enemy : enemies) {
+            if (!enemy) continue;
+
+            // Enemy attacks hitting the player
+            if (enemy->getState() == ENEMY_ATTACKING) {
+                SDL_Rect enemyAttackBox = enemy->getAttackHitbox();
+
+                if (SDL_HasIntersection(&enemyAttackBox, &playerCollider)) {
+                    if (player->isDashing) {
+                        // During dash, always ignore the hit; only the first one counts as a parry
+                        if (!player->hasParriedDuringDash) {
+                            player->hasParriedDuringDash = true;
+                            events.push_back({ DASH_PARRY, enemy });
+                        }
+                    } else if (player->isParrying) {
+                        float parryKnockback = 10.0f;
+                        player->velocityX = player->facingRight ? -parryKnockback : parryKnockback;
+                        events.push_back({ PARRY, enemy });
+                    } else {
+                        player->takeHit();
+                        events.push_back({ PLAYER_HIT, enemy });
+                    }
+                }
+            }
+
+            // Player attack hitting the enemy
+            if (playerSwinging && !enemy->isPermanentlyDisabled) {
+                SDL_Rect enemyCollider = enemy->getCollider();
+                if (SDL_HasIntersection(&playerAttackBox, &enemyCollider)) {
+                    swingConnected = true;
+                    if (!enemy->isTakingHit()) {
+                        enemy->takeHit();
+                        events.push_back({ ENEMY_HIT, enemy });
+                    }
+                }
+            }
+        }
+
+        // The first pass of a swing decides whether it whiffed
+        if (playerSwinging && !player->attackResolved) {
+            player->attackResolved = true;
+            if (!swingConnected) {
+                events.push_back({ ATTACK_MISSED, nullptr });
+            }
+        }
+    }
 }
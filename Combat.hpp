@@ -1,15 +1,37 @@
 #ifndef COMBAT_HPP
 #define COMBAT_HPP
 
+#include <vector>
+
 // Forward declaration of GameObject
 class GameObject;
+class Enemy;
 
 namespace Combat {
+    // Outcomes produced by one combat resolution pass
+    enum CombatEventType {
+        ENEMY_HIT,      // Player attack landed on an enemy
+        ATTACK_MISSED,  // Player swing found no target (reported once per swing)
+        PARRY,          // Enemy attack parried
+        DASH_PARRY,     // Enemy attack dodged through during a dash
+        PLAYER_HIT      // Enemy attack landed on the player
+    };
+
+    struct CombatEvent {
+        CombatEventType type;
+        Enemy* enemy;
+    };
+
     // Sets the attack state for the player
     void attack(GameObject* player);
     
     // Sets the parry state
     void parry();
+
+    // Check every active attack hitbox against its targets in a single pass.
+    // Hit reactions are applied here; sounds, counters and UI are left to the
+    // caller, which consumes the appended events.
+    void resolve(GameObject* player, const std::vector<Enemy*>& enemies, std::vector<CombatEvent>& events);
 }
 
 #endif // COMBAT_HPP
@@ -3,33 +3,14 @@
 #include "TextureManager.h"
 #include "Game.hpp"
 #include "Physics.hpp"
+#include "GameClock.h"
+#include "RenderQueue.h"
+#include "Telemetry.h"
 #include <SDL.h>
 #include <iostream>
-#include <cstring>
 #include <cmath>
 
-bool Enemy::loadEnemyAnimationData(const char* path, SDL_Texture*& texture, int& totalFrames, int& frameWidth, int& frameHeight) {
-    texture = TextureManager::loadTexture(path);
-    if (!texture) return false;
-
-    int w, h;
-    SDL_QueryTexture(texture, NULL, NULL, &w, &h);
-    frameHeight = h;
-
-    if (strcmp(path, "assets/Idle.png") == 0) totalFrames = 11;
-    else if (strcmp(path, "assets/Run.png") == 0) totalFrames = 8;
-    else if (strcmp(path, "assets/Attack.png") == 0) totalFrames = 6;
-    else if (strcmp(path, "assets/Take Hit.png") == 0) totalFrames = 4;
-    else if (strcmp(path, "assets/Death.png") == 0) totalFrames = 9;
-    else totalFrames = 1;
-
-    if (totalFrames > 0) frameWidth = w / totalFrames;
-    else { frameWidth = w; totalFrames = 1; }
-    return true;
-}
-
-Enemy::Enemy(const char* idleTexturePath, const char* runTexturePath, const char* attackTexturePath,
-             const char* takeHitTexturePath, const char* deathTexturePath, int x, int y, float scale)
+Enemy::Enemy(const EnemyArchetype* archetype, int x, int y, float scale)
     : prevX(x), prevY(y),
       velocityX(0.0f), velocityY(0.0f),
       onGround(false),
@@ -41,63 +22,33 @@ Enemy::Enemy(const char* idleTexturePath, const char* runTexturePath, const char
       scale(scale),
       colliderOffsetX(0), colliderOffsetY(0),
       facingRight(true),
-      idleTexture(nullptr), runTexture(nullptr), attackTexture(nullptr),
-      takeHitTexture(nullptr), deathTexture(nullptr), currentTexture(nullptr),
+      onScreen(true),
+      archetype(archetype),
+      anim{ENEMY_IDLE, GameClock::getInstance().now()},
       isAttacking(false),
       attackStartTime(0),
-      attackHitboxDuration(10),
-      attackAnimDuration(300),
-      attackRange(65.0f),
       lastAttackTime(0),
-      attackCooldown(1000),
-      idleTotalFrames(0), runTotalFrames(0), attackTotalFrames(0),
-      takeHitTotalFrames(0), deathTotalFrames(0), currentTotalFrames(0),
-      idleFrameWidth(0), idleFrameHeight(0), runFrameWidth(0), runFrameHeight(0),
-      attackFrameWidth(0), attackFrameHeight(0),
-      takeHitFrameWidth(0), takeHitFrameHeight(0), deathFrameWidth(0), deathFrameHeight(0),
-      currentFrameWidth(0), currentFrameHeight(0),
-      idleAnimSpeed(100),
-      runAnimSpeed(80),
-      attackAnimSpeed(100),
-      takeHitAnimSpeed(100),
-      deathAnimSpeed(150),
-      currentAnimSpeed(100),
-      lastFrameTime(SDL_GetTicks()),
       takeHitStartTime(0),
-      takeHitDuration(300),
       isFlashing(false),
       flashStartTime(0),
-      flashDuration(150),
-      flashAlpha(255)
+      flashAlpha(255),
+      attackTimer(TimerWheel::INVALID_TIMER),
+      takeHitTimer(TimerWheel::INVALID_TIMER),
+      flashTimer(TimerWheel::INVALID_TIMER)
 {
-    // Load all textures with error checking
-    if (!loadEnemyAnimationData(idleTexturePath, idleTexture, idleTotalFrames, idleFrameWidth, idleFrameHeight) ||
-        !loadEnemyAnimationData(runTexturePath, runTexture, runTotalFrames, runFrameWidth, runFrameHeight)) {
-        std::cerr << "Error: Failed to load critical animations for Enemy!" << std::endl;
+    if (!archetype || !archetype->isValid()) {
+        std::cerr << "Error: Enemy created without a loaded archetype!" << std::endl;
         return;
     }
 
-    // Load optional animations
-    if (!loadEnemyAnimationData(attackTexturePath, attackTexture, attackTotalFrames, attackFrameWidth, attackFrameHeight)) {
-        std::cerr << "Warning: Failed to load attack animation" << std::endl;
-    }
-    if (!loadEnemyAnimationData(takeHitTexturePath, takeHitTexture, takeHitTotalFrames, takeHitFrameWidth, takeHitFrameHeight)) {
-        std::cerr << "Warning: Failed to load take hit animation" << std::endl;
-    }
-    if (!loadEnemyAnimationData(deathTexturePath, deathTexture, deathTotalFrames, deathFrameWidth, deathFrameHeight)) {
-        std::cerr << "Warning: Failed to load death animation" << std::endl;
-    }
+    // Able to attack as soon as it spawns, whatever the clock reads (now - last wraps to the cooldown)
+    lastAttackTime = GameClock::getInstance().now() - archetype->attackCooldown;
 
-    // Initialize with idle animation
-    currentTexture = idleTexture;
-    currentTotalFrames = idleTotalFrames;
-    currentFrameWidth = idleFrameWidth;
-    currentFrameHeight = idleFrameHeight;
-    currentAnimSpeed = idleAnimSpeed;
+    // Initialize with the first idle frame
+    srcRect = archetype->getAnimations().getClip(ENEMY_IDLE).frames[0];
 
     // Set up rectangles
-    destRect = { x, y, static_cast<int>(idleFrameWidth * scale), static_cast<int>(idleFrameHeight * scale) };
-    srcRect = { 0, 0, idleFrameWidth, idleFrameHeight };
+    destRect = { x, y, static_cast<int>(srcRect.w * scale), static_cast<int>(srcRect.h * scale) };
 
     // Set up collider as half the size of destRect
     collider.w = destRect.w / 2;
@@ -108,14 +59,127 @@ Enemy::Enemy(const char* idleTexturePath, const char* runTexturePath, const char
 
 Enemy::~Enemy() {
     // Textures are handled by TextureManager
+    // Pending timers capture this enemy, drop them before it goes away
+    TimerWheel& timers = TimerWheel::getInstance();
+    timers.cancel(attackTimer);
+    timers.cancel(takeHitTimer);
+    timers.cancel(flashTimer);
+}
+
+void Enemy::endAttack() {
+    attackTimer = TimerWheel::INVALID_TIMER;
+    isAttacking = false;
+    if (!isInHitState && !isPermanentlyDisabled) {
+        setAnimation(ENEMY_IDLE);
+    }
+}
+
+void Enemy::endTakeHit() {
+    takeHitTimer = TimerWheel::INVALID_TIMER;
+    isInHitState = false;
+    isPermanentlyDisabled = true;
+    setAnimation(ENEMY_DEATH);
+    velocityX = 0.0f;
+}
+
+int Enemy::getRenderX(double fraction) const {
+    return prevX + static_cast<int>(std::lround((xpos - prevX) * fraction));
+}
+
+int Enemy::getRenderY(double fraction) const {
+    return prevY + static_cast<int>(std::lround((ypos - prevY) * fraction));
+}
+
+void Enemy::endFlash() {
+    flashTimer = TimerWheel::INVALID_TIMER;
+    isFlashing = false;
+}
+
+void Enemy::saveState(SnapshotFormat::EnemyState& state) const {
+    const TimerWheel& timers = TimerWheel::getInstance();
+    auto timeLeft = [&timers](TimerWheel::TimerId id) {
+        return timers.isPending(id) ? timers.remaining(id) : SnapshotFormat::NO_TIMER;
+    };
+
+    state = SnapshotFormat::EnemyState();
+    state.x = xpos;
+    state.y = ypos;
+    state.prevX = prevX;
+    state.prevY = prevY;
+    state.velocityX = velocityX;
+    state.velocityY = velocityY;
+    state.scale = scale;
+    state.onGround = onGround;
+    state.facingRight = facingRight;
+    state.currentState = static_cast<std::uint8_t>(currentState);
+    state.isInHitState = isInHitState;
+    state.isPermanentlyDisabled = isPermanentlyDisabled;
+    state.isAttacking = isAttacking;
+    state.isFlashing = isFlashing;
+    state.flashAlpha = flashAlpha;
+    state.attackStartTime = attackStartTime;
+    state.lastAttackTime = lastAttackTime;
+    state.takeHitStartTime = takeHitStartTime;
+    state.flashStartTime = flashStartTime;
+    state.animClip = anim.clip;
+    state.animStartTime = anim.startTime;
+    state.currentFrame = currentFrame;
+
+    state.attackTimer = timeLeft(attackTimer);
+    state.takeHitTimer = timeLeft(takeHitTimer);
+    state.flashTimer = timeLeft(flashTimer);
+}
+
+bool Enemy::isValidState(const SnapshotFormat::EnemyState& state, const EnemyArchetype* archetype) {
+    return archetype && archetype->isValid() &&
+           state.currentState <= ENEMY_DEATH && archetype->getAnimations().hasClip(state.animClip) &&
+           std::isfinite(state.scale) && state.scale > 0.0f && state.scale <= 16.0f &&
+           std::isfinite(state.velocityX) && std::isfinite(state.velocityY);
+}
+
+bool Enemy::loadState(const SnapshotFormat::EnemyState& state) {
+    if (!isValidState(state, archetype)) return false;
+
+    // Scale is fixed at construction (it sizes destRect), so only the moving parts are restored here
+    prevX = state.prevX;
+    prevY = state.prevY;
+    setX(state.x);
+    setY(state.y);
+    velocityX = state.velocityX;
+    velocityY = state.velocityY;
+    onGround = state.onGround != 0;
+    facingRight = state.facingRight != 0;
+    currentState = static_cast<EnemyAnimationState>(state.currentState);
+    isInHitState = state.isInHitState != 0;
+    isPermanentlyDisabled = state.isPermanentlyDisabled != 0;
+    isAttacking = state.isAttacking != 0;
+    isFlashing = state.isFlashing != 0;
+    flashAlpha = state.flashAlpha;
+    attackStartTime = state.attackStartTime;
+    lastAttackTime = state.lastAttackTime;
+    takeHitStartTime = state.takeHitStartTime;
+    flashStartTime = state.flashStartTime;
+    anim.clip = state.animClip;
+    anim.startTime = state.animStartTime;
+    currentFrame = state.currentFrame;
+
+    // Timers come back with the time they had left
+    TimerWheel& timers = TimerWheel::getInstance();
+    timers.cancel(attackTimer);
+    timers.cancel(takeHitTimer);
+    timers.cancel(flashTimer);
+    if (state.attackTimer != SnapshotFormat::NO_TIMER) attackTimer = timers.schedule(state.attackTimer, [this]() { endAttack(); });
+    if (state.takeHitTimer != SnapshotFormat::NO_TIMER) takeHitTimer = timers.schedule(state.takeHitTimer, [this]() { endTakeHit(); });
+    if (state.flashTimer != SnapshotFormat::NO_TIMER) flashTimer = timers.schedule(state.flashTimer, [this]() { endFlash(); });
+    return true;
 }
 
 void Enemy::tryAttack(const GameObject* player) {
     // Don't attack if any of these conditions are true
     if (!player || isPermanentlyDisabled || isInHitState || isAttacking || player->permanentlyDisabled) return;
 
-    Uint32 currentTime = SDL_GetTicks();
-    if (currentTime - lastAttackTime < attackCooldown) return;
+    Uint32 currentTime = GameClock::getInstance().now();
+    if (currentTime - lastAttackTime < archetype->attackCooldown) return;
 
     // Calculate distance to player
     float dx = player->getX() - xpos;
@@ -126,25 +190,28 @@ void Enemy::tryAttack(const GameObject* player) {
     facingRight = dx > 0;
 
     // If within attack range and not currently attacking
-    if (distance <= attackRange) {
+    if (distance <= archetype->attackRange) {
         isAttacking = true;
         attackStartTime = currentTime;
         lastAttackTime = currentTime;
         setAnimation(ENEMY_ATTACKING);
         velocityX = 0.0f; // Stop moving while attacking
+        Telemetry::getInstance().record(TelemetryFormat::EVENT_ENEMY_ATTACK, 0, xpos, ypos);
+
+        TimerWheel& timers = TimerWheel::getInstance();
+        timers.cancel(attackTimer);
+        attackTimer = timers.schedule(archetype->attackAnimDuration, [this]() { endAttack(); });
     }
 }
 
 void Enemy::update(const GameObject* player) {
-    Uint32 currentTime = SDL_GetTicks();
+    Uint32 currentTime = GameClock::getInstance().now();
 
-    // Update flash effect
+    // Fade out the flash (expiry is handled by the timer wheel)
     if (isFlashing) {
         Uint32 flashElapsed = currentTime - flashStartTime;
-        if (flashElapsed >= flashDuration) {
-            isFlashing = false;
-        } else {
-            flashAlpha = static_cast<Uint8>(255 * (1.0f - static_cast<float>(flashElapsed) / flashDuration));
+        if (flashElapsed < archetype->flashDuration) {
+            flashAlpha = static_cast<Uint8>(255 * (1.0f - static_cast<float>(flashElapsed) / archetype->flashDuration));
         }
     }
 
@@ -153,79 +220,27 @@ void Enemy::update(const GameObject* player) {
         tryAttack(player);
     }
 
-    // Handle hit state and death transition
-    if (isInHitState) {
-        if (currentTime - takeHitStartTime >= takeHitDuration) {
-            isInHitState = false;
-            isPermanentlyDisabled = true;
-            setAnimation(ENEMY_DEATH);
-            currentFrame = 0;
-            velocityX = 0.0f;
-        }
-    }
-
-    // Handle attack state
-    if (isAttacking) {
-        Uint32 attackElapsed = currentTime - attackStartTime;
-
-        // Update animation frames based on total animation duration
-        int expectedFrame = (attackElapsed * attackTotalFrames) / attackAnimDuration;
-        if (expectedFrame < attackTotalFrames && expectedFrame != currentFrame) {
-            currentFrame = expectedFrame;
-            lastFrameTime = currentTime;
-        }
-
-        // End attack animation when duration is exceeded
-        if (attackElapsed >= attackAnimDuration) {
-            isAttacking = false;
-            if (!isInHitState && !isPermanentlyDisabled) {
-                setAnimation(ENEMY_IDLE);
-            }
-        }
-    }
-
-    // Update animation state based on movement and conditions
+    // The end of the attack and the hit -> death transition are fired by the timer wheel
     if (!isInHitState && !isAttacking && currentState != ENEMY_DEATH) {
         if (isPermanentlyDisabled) {
             setAnimation(ENEMY_DEATH);
         } else {
-            bool isMoving = std::fabs(velocityX) > 0.1f;
-            if (isMoving && currentState != ENEMY_RUNNING) {
-                setAnimation(ENEMY_RUNNING);
-            } else if (!isMoving && currentState != ENEMY_IDLE) {
-                setAnimation(ENEMY_IDLE);
-            }
+            setAnimation(std::fabs(velocityX) > 0.1f ? ENEMY_RUNNING : ENEMY_IDLE);
         }
     }
 
-    // Update animation frames for non-attack animations
-    if (currentTexture && currentTotalFrames > 1 && !isAttacking) {
-        Uint32 elapsedTime = currentTime - lastFrameTime;
-        if (elapsedTime >= static_cast<Uint32>(currentAnimSpeed)) {
-            lastFrameTime = currentTime;
-
-            if (currentState == ENEMY_DEATH) {
-                if (currentFrame < currentTotalFrames - 1) {
-                    currentFrame++;
-                }
-            } else if (currentState == ENEMY_TAKE_HIT) {
-                if (currentFrame < currentTotalFrames - 1) {
-                    currentFrame++;
-                }
-            } else {
-                currentFrame = (currentFrame + 1) % currentTotalFrames;
-            }
+    // Resolve the frame from the clip table. Clips are time based, so an
+    // off-screen enemy can skip this and still be on the right frame later.
+    if (onScreen) {
+        const AnimationTable& animations = archetype->getAnimations();
+        currentFrame = animations.advance(anim, currentTime);
+        if (animations.hasClip(anim.clip)) {
+            srcRect = animations.getClip(anim.clip).frames[currentFrame];
         }
     }
 
-    // Update rectangles
-    srcRect.x = currentFrame * currentFrameWidth;
-    srcRect.y = 0;
-    srcRect.w = currentFrameWidth;
-    srcRect.h = currentFrameHeight;
-
-    destRect.w = static_cast<int>(currentFrameWidth * scale);
-    destRect.h = static_cast<int>(currentFrameHeight * scale);
+    destRect.w = static_cast<int>(srcRect.w * scale);
+    destRect.h = static_cast<int>(srcRect.h * scale);
     destRect.x = xpos;
     destRect.y = ypos;
 
@@ -239,7 +254,7 @@ void Enemy::update(const GameObject* player) {
 SDL_Rect Enemy::getAttackHitbox() const {
     // Only return a valid hitbox if we're attacking AND within the 10ms window
     if (currentState != ENEMY_ATTACKING ||
-        SDL_GetTicks() - attackStartTime > attackHitboxDuration) {
+        GameClock::getInstance().now() - attackStartTime > archetype->attackHitboxDuration) {
         return {0, 0, 0, 0};
     }
 
@@ -261,67 +276,27 @@ void Enemy::setAnimation(EnemyAnimationState newState) {
     if (currentState == newState) return;
 
     currentState = newState;
+    AnimationTable::play(anim, newState, GameClock::getInstance().now());
     currentFrame = 0;
-    lastFrameTime = SDL_GetTicks();
-
-    switch(newState) {
-        case ENEMY_IDLE:
-            currentTexture = idleTexture;
-            currentTotalFrames = idleTotalFrames;
-            currentFrameWidth = idleFrameWidth;
-            currentFrameHeight = idleFrameHeight;
-            currentAnimSpeed = idleAnimSpeed;
-            break;
-        case ENEMY_RUNNING:
-            currentTexture = runTexture;
-            currentTotalFrames = runTotalFrames;
-            currentFrameWidth = runFrameWidth;
-            currentFrameHeight = runFrameHeight;
-            currentAnimSpeed = runAnimSpeed;
-            break;
-        case ENEMY_ATTACKING:
-            currentTexture = attackTexture;
-            currentTotalFrames = attackTotalFrames;
-            currentFrameWidth = attackFrameWidth;
-            currentFrameHeight = attackFrameHeight;
-            currentAnimSpeed = attackAnimSpeed;
-            break;
-        case ENEMY_TAKE_HIT:
-            currentTexture = takeHitTexture;
-            currentTotalFrames = takeHitTotalFrames;
-            currentFrameWidth = takeHitFrameWidth;
-            currentFrameHeight = takeHitFrameHeight;
-            currentAnimSpeed = takeHitAnimSpeed;
-            break;
-        case ENEMY_DEATH:
-            currentTexture = deathTexture;
-            currentTotalFrames = deathTotalFrames;
-            currentFrameWidth = deathFrameWidth;
-            currentFrameHeight = deathFrameHeight;
-            currentAnimSpeed = deathAnimSpeed;
-            break;
-        default:
-            currentTexture = idleTexture;
-            currentTotalFrames = idleTotalFrames;
-            currentFrameWidth = idleFrameWidth;
-            currentFrameHeight = idleFrameHeight;
-            currentAnimSpeed = idleAnimSpeed;
-            break;
-    }
 }
 
 void Enemy::takeHit() {
     if (!isInHitState && !isPermanentlyDisabled) {
+        Uint32 currentTime = GameClock::getInstance().now();
         isInHitState = true;
-        takeHitStartTime = SDL_GetTicks();
-        takeHitDuration = takeHitTotalFrames * takeHitAnimSpeed;
-        if (takeHitDuration <= 0) takeHitDuration = 300;
+        takeHitStartTime = currentTime;
 
         // Start flash effect
         isFlashing = true;
-        flashStartTime = SDL_GetTicks();
+        flashStartTime = currentTime;
         flashAlpha = 255;
 
+        TimerWheel& timers = TimerWheel::getInstance();
+        timers.cancel(takeHitTimer);
+        takeHitTimer = timers.schedule(archetype->getTakeHitDuration(), [this]() { endTakeHit(); });
+        timers.cancel(flashTimer);
+        flashTimer = timers.schedule(archetype->flashDuration, [this]() { endFlash(); });
+
         setAnimation(ENEMY_TAKE_HIT);
 
         // Add knockback effect based on the direction the enemy is facing
@@ -339,7 +314,7 @@ void Enemy::aiMoveTowards(int targetX) {
         return;
     }
 
-    float moveSpeed = 3.0f;
+    float moveSpeed = archetype->moveSpeed;
     float distanceToTarget = targetX - xpos;
     float minMoveThreshold = 5.0f;
 
@@ -359,24 +334,11 @@ void Enemy::aiMoveTowards(int targetX) {
 }
 
 void Enemy::render() {
-    if (!currentTexture) return;
+    if (!archetype || !archetype->getAnimations().hasClip(anim.clip)) return;
     SDL_RendererFlip flip = facingRight ? SDL_FLIP_NONE : SDL_FLIP_HORIZONTAL;
 
-    // If flashing, set the blend mode and color mod
-    if (isFlashing) {
-        SDL_SetTextureBlendMode(currentTexture, SDL_BLENDMODE_ADD);
-        SDL_SetTextureColorMod(currentTexture, 255, 255, 255);
-        SDL_SetTextureAlphaMod(currentTexture, flashAlpha);
-    }
-
-    SDL_RenderCopyEx(Game::renderer, currentTexture, &srcRect, &destRect, 0, NULL, flip);
-
-    // Reset texture properties after rendering
-    if (isFlashing) {
-        SDL_SetTextureBlendMode(currentTexture, SDL_BLENDMODE_BLEND);
-        SDL_SetTextureColorMod(currentTexture, 255, 255, 255);
-        SDL_SetTextureAlphaMod(currentTexture, 255);
-    }
+    AnimationTable::submitFrame(LAYER_ENTITIES, archetype->getAnimations().getClip(anim.clip), srcRect, destRect, flip,
+                                isFlashing, flashAlpha);
 
     /*
     // Draw enemy collider box (blue)
@@ -416,25 +378,12 @@ void Enemy::render() {
 }
 
 void Enemy::render(int x, int y) {
-    if (!currentTexture) return;
+    if (!archetype || !archetype->getAnimations().hasClip(anim.clip)) return;
     SDL_Rect tempDestRect = {x, y, destRect.w, destRect.h};
     SDL_RendererFlip flip = facingRight ? SDL_FLIP_NONE : SDL_FLIP_HORIZONTAL;
 
-    // If flashing, set the blend mode and color mod
-    if (isFlashing) {
-        SDL_SetTextureBlendMode(currentTexture, SDL_BLENDMODE_ADD);
-        SDL_SetTextureColorMod(currentTexture, 255, 255, 255);
-        SDL_SetTextureAlphaMod(currentTexture, flashAlpha);
-    }
-
-    SDL_RenderCopyEx(Game::renderer, currentTexture, &srcRect, &tempDestRect, 0, NULL, flip);
-
-    // Reset texture properties after rendering
-    if (isFlashing) {
-        SDL_SetTextureBlendMode(currentTexture, SDL_BLENDMODE_BLEND);
-        SDL_SetTextureColorMod(currentTexture, 255, 255, 255);
-        SDL_SetTextureAlphaMod(currentTexture, 255);
-    }
+    AnimationTable::submitFrame(LAYER_ENTITIES, archetype->getAnimations().getClip(anim.clip), srcRect, tempDestRect, flip,
+                                isFlashing, flashAlpha);
 
     /*
     // Draw enemy collider box (blue) with camera offset
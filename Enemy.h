@@ -3,27 +3,18 @@
 #include "Game.hpp"
 #include "TextureManager.h"
 #include "Physics.hpp"
+#include "TimerWheel.h"
+#include "EnemyArchetype.h"
+#include "SnapshotFormat.h"
 #include <string>
 #include <vector>
 #include <iostream>
 
 class Physics;
 
-// Enemy animation states
-enum EnemyAnimationState {
-    ENEMY_IDLE,
-    ENEMY_RUNNING,
-    ENEMY_JUMPING,
-    ENEMY_ATTACKING,
-    ENEMY_TAKE_HIT,
-    ENEMY_DEATH
-};
-
 class Enemy {
 public:
-    Enemy(const char* idleTexturePath, const char* runTexturePath, const char* attackTexturePath,
-          const char* takeHitTexturePath, const char* deathTexturePath,
-          int x, int y, float scale = 1.0f);
+    Enemy(const EnemyArchetype* archetype, int x, int y, float scale = 1.0f);
     ~Enemy();
 
     void update(const GameObject* player);
@@ -36,6 +27,9 @@ public:
     void setX(int x) { xpos = x; destRect.x = x; collider.x = x + colliderOffsetX; }
     void setY(int y) { ypos = y; destRect.y = y; collider.y = y + colliderOffsetY; }
     void revertPosition() { setX(prevX); setY(prevY); }
+    // Position to draw at, blended from the previous step's by GameClock::stepFraction()
+    int getRenderX(double fraction) const;
+    int getRenderY(double fraction) const;
     SDL_Rect getCollider() const { return collider; }
     bool isTakingHit() const { return isInHitState; }
     void takeHit();
@@ -45,6 +39,17 @@ public:
     SDL_Rect getAttackHitbox() const;
     int getCurrentFrame() const { return currentFrame; }
 
+    // Set by the view culling stage; off-screen enemies skip animation frame work
+    void setOnScreen(bool visible) { onScreen = visible; }
+    bool isOnScreen() const { return onScreen; }
+
+    // Copy the physics, animation and timer state to or from a game-state snapshot.
+    // loadState expects the game clock to be restored already.
+    void saveState(SnapshotFormat::EnemyState& state) const;
+    // False (and nothing changed) if the state holds values the game can't use
+    bool loadState(const SnapshotFormat::EnemyState& state);
+    static bool isValidState(const SnapshotFormat::EnemyState& state, const EnemyArchetype* archetype);
+
     // Physics properties
     int prevX, prevY;
     float velocityX, velocityY;
@@ -63,47 +68,36 @@ private:
     SDL_Rect collider;
     int colliderOffsetX, colliderOffsetY;
     bool facingRight;
+    bool onScreen;
 
-    // Animation properties
-    SDL_Texture* idleTexture;
-    SDL_Texture* runTexture;
-    SDL_Texture* attackTexture;
-    SDL_Texture* takeHitTexture;
-    SDL_Texture* deathTexture;
-    SDL_Texture* currentTexture;
+    // Shared clips and tuning, plus this enemy's playing clip
+    const EnemyArchetype* archetype;
+    AnimationCursor anim;
 
     // Attack properties
     bool isAttacking;
     Uint32 attackStartTime;
-    Uint32 attackHitboxDuration;  // Duration for the actual hitbox 
-    Uint32 attackAnimDuration;    // Duration for the full attack animation
-    float attackRange;
     Uint32 lastAttackTime;
-    Uint32 attackCooldown;
-
-    // Animation frame properties
-    int idleTotalFrames, runTotalFrames, attackTotalFrames, takeHitTotalFrames, deathTotalFrames, currentTotalFrames;
-    int idleFrameWidth, idleFrameHeight, runFrameWidth, runFrameHeight;
-    int attackFrameWidth, attackFrameHeight;
-    int takeHitFrameWidth, takeHitFrameHeight, deathFrameWidth, deathFrameHeight;
-    int currentFrameWidth, currentFrameHeight;
-    int idleAnimSpeed, runAnimSpeed, attackAnimSpeed, takeHitAnimSpeed, deathAnimSpeed, currentAnimSpeed;
 
     // Timing properties
-    Uint32 lastFrameTime;
     Uint32 takeHitStartTime;
-    Uint32 takeHitDuration;
 
     // Hit flash effect properties
     bool isFlashing;
     Uint32 flashStartTime;
-    Uint32 flashDuration;
     Uint8 flashAlpha;
 
+    // Pending expirations in the shared timer wheel
+    TimerWheel::TimerId attackTimer;
+    TimerWheel::TimerId takeHitTimer;
+    TimerWheel::TimerId flashTimer;
+
     // Helper methods
-    bool loadEnemyAnimationData(const char* path, SDL_Texture*& texture, int& totalFrames, int& frameWidth, int& frameHeight);
     void setAnimation(EnemyAnimationState newState);
     void tryAttack(const GameObject* player);
+    void endAttack();
+    void endTakeHit();
+    void endFlash();
 
     friend class Physics;
     friend class Game;
@@ -0,0 +1,56 @@
+#include "EnemyArchetype.h"
+#include "Game.hpp"
+#include <iostream>
+
+// Clip layout shared by every enemy sprite sheet
+struct EnemyClipDef {
+    EnemyAnimationState state;
+    int frames;
+    Uint32 frameDuration;
+    ClipPlayback playback;
+    int nextClip;
+};
+
+static const EnemyClipDef ENEMY_CLIPS[] = {
+    { ENEMY_IDLE,      11, 100, CLIP_LOOP, -1 },
+    { ENEMY_RUNNING,    8,  80, CLIP_LOOP, -1 },
+    { ENEMY_ATTACKING,  6,  50, CLIP_ONCE, -1 },
+    { ENEMY_TAKE_HIT,   4, 100, CLIP_ONCE, ENEMY_DEATH },
+    { ENEMY_DEATH,      9, 150, CLIP_ONCE, -1 }
+};
+
+EnemyArchetype::EnemyArchetype(const char* idleTexturePath, const char* runTexturePath, const char* attackTexturePath,
+                               const char* takeHitTexturePath, const char* deathTexturePath) {
+    // Load all textures with error checking
+    if (!loadClip(ENEMY_IDLE, idleTexturePath) || !loadClip(ENEMY_RUNNING, runTexturePath)) {
+        std::cerr << "Error: Failed to load critical animations for Enemy!" << std::endl;
+        return;
+    }
+
+    // Load optional animations
+    if (!loadClip(ENEMY_ATTACKING, attackTexturePath)) {
+        std::cerr << "Warning: Failed to load attack animation" << std::endl;
+    }
+    if (!loadClip(ENEMY_TAKE_HIT, takeHitTexturePath)) {
+        std::cerr << "Warning: Failed to load take hit animation" << std::endl;
+    }
+    if (!loadClip(ENEMY_DEATH, deathTexturePath)) {
+        std::cerr << "Warning: Failed to load death animation" << std::endl;
+    }
+}
+
+bool EnemyArchetype::loadClip(EnemyAnimationState state, const char* path) {
+    AtlasRegion sheet = TextureAtlas::loadRegion(Game::spriteAtlas, path);
+    if (!sheet.texture) return false;
+
+    for (const EnemyClipDef& def : ENEMY_CLIPS) {
+        if (def.state == state) {
+            return animations.defineStrip(state, sheet, def.frames, def.frameDuration, def.playback, def.nextClip);
+        }
+    }
+    return false;
+}
+
+Uint32 EnemyArchetype::getTakeHitDuration() const {
+    return animations.hasClip(ENEMY_TAKE_HIT) ? animations.getClip(ENEMY_TAKE_HIT).length() : 300;
+}
@@ -0,0 +1,43 @@
+#pragma once
+#include <SDL.h>
+#include "Animation.h"
+
+// Enemy animation states
+enum EnemyAnimationState {
+    ENEMY_IDLE,
+    ENEMY_RUNNING,
+    ENEMY_JUMPING,
+    ENEMY_ATTACKING,
+    ENEMY_TAKE_HIT,
+    ENEMY_DEATH
+};
+
+// Data shared by every enemy of one kind: the clip table and combat tuning.
+// Built once at load time and never changed afterwards; enemies only keep a pointer to it.
+class EnemyArchetype {
+public:
+    EnemyArchetype(const char* idleTexturePath, const char* runTexturePath, const char* attackTexturePath,
+                   const char* takeHitTexturePath, const char* deathTexturePath);
+
+    // False if the idle or run clip could not be loaded
+    bool isValid() const { return animations.hasClip(ENEMY_IDLE) && animations.hasClip(ENEMY_RUNNING); }
+
+    const AnimationTable& getAnimations() const { return animations; }
+    Uint32 getTakeHitDuration() const;
+
+    // Combat tuning
+    const Uint32 attackHitboxDuration = 10;  // Duration for the actual hitbox
+    const Uint32 attackAnimDuration = 300;   // Duration for the full attack animation
+    const float attackRange = 65.0f;
+    const Uint32 attackCooldown = 1000;
+    const Uint32 flashDuration = 150;
+    const float moveSpeed = 3.0f;
+
+private:
+    EnemyArchetype(const EnemyArchetype&) = delete;
+    EnemyArchetype& operator=(const EnemyArchetype&) = delete;
+
+    bool loadClip(EnemyAnimationState state, const char* path);
+
+    AnimationTable animations;
+};
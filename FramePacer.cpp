@@ -0,0 +1,126 @@
+#include "FramePacer.h"
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+FramePacer::FramePacer()
+    : mode(PACE_VSYNC),
+      targetFps(60.0),
+      frequency(SDL_GetPerformanceFrequency()),
+      framePeriod(0),
+      nextDeadline(0),
+      lastPresent(0),
+      totalMissed(0),
+      windowMissed(0),
+      windowFrames(0),
+      windowStart(0)
+{
+    setMode(PACE_VSYNC);
+}
+
+void FramePacer::configure(int argc, char* argv[]) {
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--vsync") == 0) {
+            setMode(PACE_VSYNC);
+        } else if (std::strcmp(argv[i], "--uncapped") == 0) {
+            setMode(PACE_UNCAPPED);
+        } else if (std::strcmp(argv[i], "--fps") == 0 && i + 1 < argc) {
+            double fps = std::atof(argv[++i]);
+            if (fps > 0.0) {
+                setMode(PACE_CAP, fps);
+            } else {
+                std::cout << "Ignoring invalid frame rate: " << argv[i] << std::endl;
+            }
+        }
+    }
+}
+
+void FramePacer::setMode(PacingMode newMode, double fps) {
+    mode = newMode;
+    if (fps > 0.0) targetFps = fps;
+    framePeriod = (mode == PACE_UNCAPPED) ? 0 : static_cast<Uint64>(frequency / targetFps);
+    nextDeadline = 0;
+}
+
+void FramePacer::apply(SDL_Renderer* renderer) {
+    if (!renderer) return;
+
+    // Display refresh rate, used as the frame period for vsync
+    int refreshRate = 60;
+    SDL_DisplayMode displayMode;
+    SDL_Window* window = SDL_RenderGetWindow(renderer);
+    if (window && SDL_GetWindowDisplayMode(window, &displayMode) == 0 && displayMode.refresh_rate > 0) {
+        refreshRate = displayMode.refresh_rate;
+    }
+
+    if (mode == PACE_VSYNC) {
+        if (SDL_RenderSetVSync(renderer, 1) == 0) {
+            setMode(PACE_VSYNC, refreshRate);
+        } else {
+            std::cout << "Vsync unavailable, capping at " << refreshRate << " fps. Error: " << SDL_GetError() << std::endl;
+            setMode(PACE_CAP, refreshRate);
+        }
+    } else if (SDL_RenderSetVSync(renderer, 0) != 0) {
+        std::cout << "Failed to turn off vsync. Error: " << SDL_GetError() << std::endl;
+    }
+
+    const char* modeNames[] = { "vsync", "capped", "uncapped" };
+    std::cout << "Frame pacing: " << modeNames[mode];
+    if (mode != PACE_UNCAPPED) std::cout << " at " << targetFps << " fps";
+    std::cout << std::endl;
+}
+
+void FramePacer::endFrame() {
+    if (mode == PACE_CAP) {
+        Uint64 now = SDL_GetPerformanceCounter();
+        if (nextDeadline == 0) nextDeadline = now;
+        nextDeadline += framePeriod;
+
+        // Fell more than a frame behind: start over instead of rushing to catch up
+        if (now > nextDeadline + framePeriod) {
+            nextDeadline = now;
+        } else {
+            waitUntil(nextDeadline);
+        }
+    }
+    countFrame(SDL_GetPerformanceCounter());
+}
+
+void FramePacer::waitUntil(Uint64 deadline) const {
+    for (;;) {
+        Uint64 now = SDL_GetPerformanceCounter();
+        if (now >= deadline) return;
+
+        // Sleep while well ahead, spin on the counter for the last stretch
+        double remaining = toMs(deadline - now);
+        if (remaining > SPIN_MARGIN_MS) {
+            SDL_Delay(static_cast<Uint32>(remaining) - SPIN_MARGIN_MS);
+        }
+    }
+}
+
+void FramePacer::countFrame(Uint64 now) {
+    // A present more than 1.5 periods after the previous one skipped at least one slot
+    if (framePeriod > 0 && lastPresent != 0) {
+        Uint64 interval = now - lastPresent;
+        if (interval > framePeriod + framePeriod / 2) {
+            Uint32 missed = static_cast<Uint32>((interval + framePeriod / 2) / framePeriod) - 1;
+            windowMissed += missed;
+            totalMissed += missed;
+        }
+    }
+    lastPresent = now;
+
+    if (windowStart == 0) windowStart = now;
+    windowFrames++;
+    double elapsed = toMs(now - windowStart);
+    if (elapsed >= REPORT_INTERVAL_MS) {
+        if (windowMissed > 0) {
+            std::cout << "Frame pacer: " << windowMissed << " missed presents in " << windowFrames
+                      << " frames (" << (windowFrames * 1000.0 / elapsed) << " fps)" << std::endl;
+        }
+        windowMissed = 0;
+        windowFrames = 0;
+        windowStart = now;
+    }
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include <SDL.h>
+
+// How the main loop waits between frames
+enum PacingMode {
+    PACE_VSYNC,     // Present blocks on the display refresh
+    PACE_CAP,       // Vsync off, frames are spaced to a fixed rate
+    PACE_UNCAPPED   // Vsync off, no waiting (benchmarking)
+};
+
+// Frame pacer built on the high-resolution performance counter.
+// Capped frames sleep coarsely with SDL_Delay and spin-wait the last
+// stretch, so any target rate is hit without millisecond truncation.
+// Presents that come later than one frame period are counted as missed.
+// Only presentation is paced: gameplay steps at a fixed rate (GameClock), so
+// the pacing mode never changes how fast the game plays.
+class FramePacer {
+public:
+    FramePacer();
+
+    // Pick the mode from the command line: --vsync (default), --fps <rate>, --uncapped
+    void configure(int argc, char* argv[]);
+    void setMode(PacingMode mode, double targetFps = 60.0);
+
+    // Switch the renderer's vsync to match the mode (call once the renderer exists)
+    void apply(SDL_Renderer* renderer);
+
+    // Call once per frame right after presenting; waits out the rest of the frame if capped
+    void endFrame();
+
+    PacingMode getMode() const { return mode; }
+    double getTargetFps() const { return targetFps; }
+    Uint32 getMissedFrames() const { return totalMissed; }
+
+private:
+    double toMs(Uint64 ticks) const { return static_cast<double>(ticks) * 1000.0 / frequency; }
+    void waitUntil(Uint64 deadline) const;
+    void countFrame(Uint64 now);
+
+    PacingMode mode;
+    double targetFps;
+    Uint64 frequency;
+    Uint64 framePeriod;    // Counter ticks per frame (target rate or display refresh)
+    Uint64 nextDeadline;   // PACE_CAP: when the next frame may start
+    Uint64 lastPresent;
+
+    // Missed present stats, logged every REPORT_INTERVAL_MS when non-zero
+    Uint32 totalMissed;
+    Uint32 windowMissed;
+    Uint32 windowFrames;
+    Uint64 windowStart;
+    static const Uint32 REPORT_INTERVAL_MS = 5000;
+    static const Uint32 SPIN_MARGIN_MS = 2;  // Spin instead of sleeping for the last stretch
+};
@@ -4,20 +4,45 @@
 #include "TileMap.hpp"
 #include "Combat.hpp"
 #include "Physics.hpp"
+#include "GameClock.h"
 #include "Enemy.h"
+#include "TextureAtlas.h"
+#include "RenderQueue.h"
+#include "AssetPack.h"
+#include "AssetLoader.h"
+#include "TextureCache.h"
+#include "StatsStore.h"
+#include "Telemetry.h"
+#include "PackFormat.h"
+#include "SnapshotFormat.h"
 #include <SDL_image.h>
 #include <iostream>
 #include <algorithm> // For std::min/max
 #include <cmath>
+#include <cstring>
 #include <random>
 
 using namespace std;
 
 // Static member definitions
 SDL_Renderer* Game::renderer = nullptr;
+TextureAtlas* Game::spriteAtlas = nullptr;
 int Game::SCREEN_WIDTH = 720;  // Initial default values
 int Game::SCREEN_HEIGHT = 576;
 
+// Sounds that only play late in a session; they are prefetched when they come close
+static const char* DEATH_SOUND_PATH = "audio/Dark Souls - You Died (Sound Effect).mp3";
+static const char* RESTART_SOUND_PATH = "audio/ahhyooaaawhoaaa.mp3";
+static const char* MASTERY_SOUND_PATHS[] = { "audio/mastery_emote_tier5.mp3",
+                                             "audio/death-is-like-the-wind-always-by-my-side-101soundboards.mp3" };
+// F6 saves the game state here and F7 loads it back
+static const char* QUICKSAVE_PATH = "quicksave.snap";
+
+// Open the game font at a size, from the asset pack when there is one
+static TTF_Font* openGameFont(int size) {
+    return TTF_OpenFontRW(AssetPack::getInstance().openAsset("font/Jacquard_12/Jacquard12-Regular.ttf"), 1, size);
+}
+
 // Define mastery animation frame coordinates
 const Game::MasteryFrame Game::MASTERY_FRAMES[30] = {
     // Row 1
@@ -36,6 +61,8 @@ Game::Game() :
     isRunning(false),
     player(nullptr),
     enemies(),
+    enemyArchetype(nullptr),
+    combatEvents(),
     firstWaveDefeated(false),
     defeatedEnemyCount(0),
     tileMap(nullptr),
@@ -52,25 +79,32 @@ Game::Game() :
     parryTextColor{255, 255, 255, 255},
     parryTextSize(48),
     successfulParryCount(0),
+    parryTextTimer(TimerWheel::INVALID_TIMER),
     timerStarted(false),
     timerStartTime(0),
+    runStartTime(0),
     hasStartedTimer(false),
-    masteryTexture(nullptr),
+    roundTimer(TimerWheel::INVALID_TIMER),
+    masteryTexture("assets/mastery 7.png"),
     showMasteryAnimation(false),
     masteryStartTime(0),
     masteryFrame(0),
+    masteryTimer(TimerWheel::INVALID_TIMER),
     isFading(false),
     fadeStartTime(0),
     fadeAlpha(0),
+    fadeTimer(TimerWheel::INVALID_TIMER),
     showDeathText(false),
     deathTextStartTime(0),
     deathTextAlpha(0),
     canRestart(false),
     isPaused(false),
-    pauseScreenTexture(nullptr),
+    pauseScreenTexture("assets/999707.png"),
     showInstructions(false),
     instructionsTexture(nullptr),
-    showInitialInstructions(true)
+    showInitialInstructions(true),
+    sceneTarget(nullptr),
+    pauseFrameValid(false)
 { }
 
 Game::~Game() {
@@ -78,8 +112,22 @@ Game::~Game() {
 
 void Game::init(const char* title, int xPos, int yPos, int width, int height) {
     if (SDL_Init(SDL_INIT_EVERYTHING) == 0) {
+        // Read assets from the pack if it was built, loose files otherwise
+        if (!AssetPack::getInstance().open("data.pak")) {
+            std::cout << "No asset pack, loading loose files" << std::endl;
+        }
+
+        // Lifetime stats are read once here and kept in memory
+        StatsStore::getInstance().load();
+        // Gameplay events are streamed to telemetry.log by a writer thread
+        Telemetry::getInstance().start();
+
+        // The requested size is the logical screen size; the window itself can be resized
+        SCREEN_WIDTH = width;
+        SCREEN_HEIGHT = height;
+
         // Create window normally (not fullscreen)
-        window = SDL_CreateWindow(title, xPos, yPos, width, height, SDL_WINDOW_SHOWN);
+        window = SDL_CreateWindow(title, xPos, yPos, width, height, SDL_WINDOW_SHOWN | SDL_WINDOW_RESIZABLE);
         if (!window) {
             std::cout << "Failed to create window! SDL Error: " << SDL_GetError() << std::endl;
             isRunning = false;
@@ -93,6 +141,19 @@ void Game::init(const char* title, int xPos, int yPos, int width, int height) {
             return;
         }
 
+        // Images are decoded straight into the renderer's preferred format (and cached that way)
+        TextureCache::setNativeFormat(renderer);
+
+        // Draw the game at the logical size, then upscale once with nearest-neighbour sampling
+        SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "nearest");
+        sceneTarget = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+                                        SCREEN_WIDTH, SCREEN_HEIGHT);
+        if (!sceneTarget) {
+            std::cout << "Render targets unavailable, using renderer logical size. Error: " << SDL_GetError() << std::endl;
+            SDL_RenderSetLogicalSize(renderer, SCREEN_WIDTH, SCREEN_HEIGHT);
+            SDL_RenderSetIntegerScale(renderer, SDL_TRUE);
+        }
+
         isRunning = true;
         IMG_Init(IMG_INIT_PNG);
 
@@ -104,7 +165,7 @@ void Game::init(const char* title, int xPos, int yPos, int width, int height) {
         }
 
         // Load font
-        font = TTF_OpenFont("font/Jacquard_12/Jacquard12-Regular.ttf", 36);
+        font = openGameFont(36);
         if (!font) {
             std::cout << "Failed to load font! SDL_ttf Error: " << TTF_GetError() << std::endl;
             isRunning = false;
@@ -118,6 +179,13 @@ void Game::init(const char* title, int xPos, int yPos, int width, int height) {
             return;
         }
 
+        // Decode every startup image and sound effect in parallel behind a loading screen;
+        // the loads below then pick up the finished textures, surfaces and sounds
+        if (!loadAssets()) {
+            isRunning = false;
+            return;
+        }
+
         // Play initial background music and set up next track
         AudioManager::getInstance().playMusic("audio/medieval-star-188280.mp3");
         AudioManager::getInstance().setMusicVolume(64);
@@ -126,15 +194,9 @@ void Game::init(const char* title, int xPos, int yPos, int width, int height) {
         backgroundTexture = TextureManager::loadTexture("assets/BG1.png");
         foregroundTexture = TextureManager::loadTexture("assets/BG2.png");
         closestTexture = TextureManager::loadTexture("assets/BG3.png");
-        masteryTexture = TextureManager::loadTexture("assets/mastery 7.png");
 
-        // Load pause screen texture
-        pauseScreenTexture = TextureManager::loadTexture("assets/999707.png");
-        if (!pauseScreenTexture) {
-            std::cout << "Failed to load pause screen texture!" << std::endl;
-        }
-        
-        // Load instructions texture
+        // The pause art and mastery sheet are handles that load on first use.
+        // Load instructions texture (the start screen shows it right away)
         instructionsTexture = TextureManager::loadTexture("assets/instruction.png");
         if (!instructionsTexture) {
             std::cout << "Failed to load instructions texture!" << std::endl;
@@ -142,9 +204,23 @@ void Game::init(const char* title, int xPos, int yPos, int width, int height) {
         
         showInstructions = false;  // Regular instructions flag (for F1)
         showInitialInstructions = true;  // Show instructions at startup
-        isPaused = true;  // Pause the game initially
+        setPaused(true);  // Pause the game initially
         AudioManager::getInstance().pauseMusic();  // Pause music initially
 
+        // Pack the character sheets into one page so player and enemies batch together,
+        // each with a white flash copy for the hit flash and a mirrored copy for facing left
+        spriteAtlas = new TextureAtlas();
+        const char* characterSheets[] = { "assets/Idle.png", "assets/Run.png", "assets/Attack.png",
+                                          "assets/Take Hit.png", "assets/Death.png", "assets/Dash.png" };
+        for (const char* sheet : characterSheets) {
+            spriteAtlas->add(sheet, ATLAS_FLASH | ATLAS_MIRROR);
+        }
+        if (!spriteAtlas->build()) {
+            std::cout << "Failed to build sprite atlas, using separate textures" << std::endl;
+            delete spriteAtlas;
+            spriteAtlas = nullptr;
+        }
+
         // Initialize player with size 50x50
         player = new GameObject(50, 50, 50, 50);
         if (player == nullptr) {
@@ -154,6 +230,10 @@ void Game::init(const char* title, int xPos, int yPos, int width, int height) {
         }
         player->setGameRef(this);  // Set reference to game instance
 
+        // Load the shared enemy data once, every spawn reuses it
+        enemyArchetype = new EnemyArchetype("assets/Idle.png", "assets/Run.png", "assets/Attack.png",
+                                            "assets/Take Hit.png", "assets/Death.png");
+
         // Initialize first enemy
         spawnRandomEnemy();
 
@@ -167,22 +247,34 @@ void Game::init(const char* title, int xPos, int yPos, int width, int height) {
 }
 
 void Game::handleEvents() {
+    // Once per frame (update can run several times in a frame)
+    if (GameClock::getInstance().frameTime() > FRAME_SPIKE_THRESHOLD) {
+        Telemetry::getInstance().record(TelemetryFormat::EVENT_FRAME_SPIKE,
+            static_cast<int>(GameClock::getInstance().frameTime() * 1000.0));
+    }
+
     SDL_Event event;
     while (SDL_PollEvent(&event)) {
         if (event.type == SDL_QUIT)
             isRunning = false;
 
+        // Target textures lose their contents on a render target reset; re-bake cached layers
+        if (event.type == SDL_RENDER_TARGETS_RESET) {
+            if (tileMap) tileMap->invalidate();
+            pauseFrameValid = false;
+        }
+
         if (event.type == SDL_KEYDOWN) {
             switch (event.key.keysym.sym) {
                 case SDLK_RETURN:  // Enter key
                     if (showInitialInstructions) {
                         showInitialInstructions = false;
-                        isPaused = false;
+                        setPaused(false);
                         AudioManager::getInstance().resumeMusic();
                     }
                     break;
                 case SDLK_ESCAPE:
-                    isPaused = !isPaused;
+                    setPaused(!isPaused);
                     showInstructions = false;  // Always hide instructions when ESC is pressed
                     if (isPaused) {
                     // Pause both music and sound effects
@@ -196,13 +288,13 @@ void Game::handleEvents() {
                     break;
                 case SDLK_F1:
                     if (!isPaused) {
-                        isPaused = true;
+                        setPaused(true);
                         showInstructions = true;
                         // Pause both music and sound effects
                         AudioManager::getInstance().pauseMusic();
                         AudioManager::getInstance().pauseAllSounds();
                     } else if (showInstructions) {
-                        isPaused = false;
+                        setPaused(false);
                         showInstructions = false;
                         // Resume both music and sound effects
                         AudioManager::getInstance().resumeMusic();
@@ -215,12 +307,22 @@ void Game::handleEvents() {
                 case SDLK_SPACE:
                     if (!isPaused) player->dash();
                     break;
+                case SDLK_F11:
+                    toggleFullscreen();
+                    break;
                 case SDLK_F5:
                     // Only allow restart if player is dead and reset text is fully visible
                     if (player && player->permanentlyDisabled && showDeathText && deathTextAlpha >= 255) {
                         restart();
                     }
                     break;
+                case SDLK_F6:
+                    // Checkpoint mid-run; the end screens are left alone
+                    if (!isPaused) saveSnapshot(QUICKSAVE_PATH);
+                    break;
+                case SDLK_F7:
+                    loadSnapshot(QUICKSAVE_PATH);
+                    break;
                 case SDLK_s:
                     break;
                 case SDLK_a:
@@ -234,7 +336,7 @@ void Game::handleEvents() {
             // Handle initial instructions dismissal
             if (showInitialInstructions) {
                 showInitialInstructions = false;
-                isPaused = false;
+                setPaused(false);
                 AudioManager::getInstance().resumeMusic();
                 return;
             }
@@ -242,7 +344,7 @@ void Game::handleEvents() {
             // Handle end game screen click to resume
             if (showEndGameScreen) {
                     showEndGameScreen = false;
-                    isPaused = false;
+                    setPaused(false);
                     // Reset timer so it doesn't immediately trigger again
                     timerStarted = false;
                     hasStartedTimer = false;
@@ -251,8 +353,11 @@ void Game::handleEvents() {
                     return; // Important to prevent processing other mouse actions
             }
 
-            int mouseX = event.button.x + cameraX; // Add camera offset to get world coordinates
-            int mouseY = event.button.y + cameraY;
+            int mouseX = event.button.x;
+            int mouseY = event.button.y;
+            windowToScene(mouseX, mouseY);
+            mouseX += cameraX; // Add camera offset to get world coordinates
+            mouseY += cameraY;
             std::cout << "Mouse clicked at: (" << mouseX << ", " << mouseY << ")" << std::endl;
 
             if (event.button.button == SDL_BUTTON_LEFT) {
@@ -264,63 +369,68 @@ void Game::handleEvents() {
         }
         if (event.type == SDL_MOUSEBUTTONDOWN && showEndGameScreen) {
             showEndGameScreen = false;
-            isPaused = false;
+            setPaused(false);
             AudioManager::getInstance().resumeMusic();
         }
     }
-    const Uint8* keyState = SDL_GetKeyboardState(NULL);
-    if (keyState[SDL_SCANCODE_A]) player->move(-1);
-    if (keyState[SDL_SCANCODE_D]) player->move(1);
 }
 
 void Game::update() {
     // Always update audio manager even when paused
     AudioManager::getInstance().update();
+    // Pick up assets prefetched in the background
+    AssetLoader::getInstance().update();
+
+    // Fire gameplay timers that came due (the clock is frozen while paused)
+    TimerWheel::getInstance().advance(GameClock::getInstance().now());
 
     // Don't update game logic if paused
     if (isPaused) {
         return;
     }
 
+    // Held movement keys are read every step, in step with friction
+    const Uint8* keyState = SDL_GetKeyboardState(NULL);
+    if (player && keyState[SDL_SCANCODE_A]) player->move(-1);
+    if (player && keyState[SDL_SCANCODE_D]) player->move(1);
+
     // Check if the player is dead and start death effects
     if (player && player->permanentlyDisabled) {
         // Stop background music when player dies (will stop every time)
         AudioManager::getInstance().stopMusic();
 
+        // The death sound plays after the fade and the restart sound after that; decode them now
+        if (!isFading) {
+            AssetLoader::getInstance().queue(DEATH_SOUND_PATH, ASSET_SOUND);
+            AssetLoader::getInstance().queue(RESTART_SOUND_PATH, ASSET_SOUND);
+        }
+
         // If death animation is complete, start fade
-        if (player->isDeathAnimationComplete()) {
-            isFading = true;
-            if (fadeStartTime == 0) { // Only set start time once
-                fadeStartTime = SDL_GetTicks();
-            }
+        if (player->isDeathAnimationComplete() && !isFading) {
+            startFadeEffect();
         }
 
         // Start death text only after fade is complete
         if (isFading && fadeAlpha >= 255 && !showDeathText) {
             showDeathText = true;
-            deathTextStartTime = SDL_GetTicks();
+            deathTextStartTime = GameClock::getInstance().now();
             deathTextAlpha = 0;
             // Play death sound effect
-            AudioManager::getInstance().playSoundEffect("audio/Dark Souls - You Died (Sound Effect).mp3");
+            AudioManager::getInstance().playSoundEffect(DEATH_SOUND_PATH);
         }
     }
 
-    // Update fade effect
-    if (isFading) {
-        Uint32 currentTime = SDL_GetTicks();
-        Uint32 elapsedTime = currentTime - fadeStartTime;
-
-        if (elapsedTime >= FADE_DURATION) {
-            fadeAlpha = 255;  // Keep screen black
-        } else {
-            // Gradually increase alpha from 0 to 255 over FADE_DURATION
-            fadeAlpha = static_cast<Uint8>((elapsedTime * 255) / FADE_DURATION);
-        }
+    // Update fade effect (the fade timer pins alpha at 255 once it completes)
+    if (isFading && fadeTimer != TimerWheel::INVALID_TIMER) {
+        Uint32 elapsedTime = GameClock::getInstance().now() - fadeStartTime;
+        if (elapsedTime > FADE_DURATION) elapsedTime = FADE_DURATION;
+        // Gradually increase alpha from 0 to 255 over FADE_DURATION
+        fadeAlpha = static_cast<Uint8>((elapsedTime * 255) / FADE_DURATION);
     }
 
     // Update death text fade in
     if (showDeathText) {
-        Uint32 currentTime = SDL_GetTicks();
+        Uint32 currentTime = GameClock::getInstance().now();
         Uint32 deathTextElapsed = currentTime - deathTextStartTime;
 
         if (deathTextElapsed >= DEATH_TEXT_DURATION) {
@@ -353,8 +463,8 @@ void Game::update() {
         } else {
             cameraX = player->getX() + player->getCollider().w / 2 - SCREEN_WIDTH / 2;
             cameraY = player->getY() + player->getCollider().h / 2 - SCREEN_HEIGHT / 2;
-            cameraX = std::max(0, std::min(cameraX, Game::MAP_COLS * Game::TILE_SIZE - SCREEN_WIDTH));
-            cameraY = std::max(0, std::min(cameraY, Game::MAP_ROWS * Game::TILE_SIZE - SCREEN_HEIGHT));
+            cameraX = std::max(0, std::min(cameraX, tileMap->getWidth() - SCREEN_WIDTH));
+            cameraY = std::max(0, std::min(cameraY, tileMap->getHeight() - SCREEN_HEIGHT));
         }
 
         player->update();
@@ -375,9 +485,15 @@ void Game::update() {
         spawnRandomEnemy();
         spawnRandomEnemy();
 
-        // Change music after defeating 10 enemies if not already changed
+        // Open the second track in the background a couple of kills ahead
+        if (defeatedEnemyCount >= 8 && !secondMusicStarted) {
+            AudioManager::getInstance().prefetchMusic("audio/medieval-adventure-270566.mp3");
+        }
+
+        // Change music after defeating 10 enemies if not already changed:
+        // the adventure track plays once and the opener follows it without a gap
         if (defeatedEnemyCount >= 10 && !secondMusicStarted) {
-            AudioManager::getInstance().playMusic("audio/medieval-adventure-270566.mp3");
+            AudioManager::getInstance().playMusic("audio/medieval-adventure-270566.mp3", 1);
             AudioManager::getInstance().setNextTrack("audio/medieval-opener-270568.mp3");
             AudioManager::getInstance().setMusicVolume(64);
             secondMusicStarted = true;
@@ -411,158 +527,217 @@ void Game::update() {
             Physics::applyGravity(enemy);
             Physics::applyFriction(enemy);
             enemy->update(player);
-
-            // Handle enemy attacks hitting player
-            if (enemy->getState() == ENEMY_ATTACKING) {
-                SDL_Rect enemyAttackBox = enemy->getAttackHitbox();
-                SDL_Rect playerCollider = player->getCollider();
-
-                if (SDL_HasIntersection(&enemyAttackBox, &playerCollider)) {
-                    if (player->isDashing) {
-                        if (!player->hasParriedDuringDash) {
-                            // Successful parry during dash
-                            AudioManager::getInstance().playRandomParrySound();
-                            player->hasParriedDuringDash = true;
-
-                            // Show parry text
-                            showParryText = true;
-                            parryTextStartTime = SDL_GetTicks();
-                            successfulParryCount++;
-
-                            // Generate random bright color
-                            parryTextColor.r = rand() % 128 + 128;
-                            parryTextColor.g = rand() % 128 + 128;
-                            parryTextColor.b = rand() % 128 + 128;
-                            parryTextColor.a = 255;
-                        }
-                        // During dash, always ignore hit regardless of parry status
-                        return;
-                    } else if (player->isParrying) {
-                        // Normal parry when not dashing
-                        float parryKnockback = 10.0f;
-                        player->velocityX = player->facingRight ? -parryKnockback : parryKnockback;
-                        AudioManager::getInstance().playRandomParrySound();
-
-                        showParryText = true;
-                        parryTextStartTime = SDL_GetTicks();
-                        successfulParryCount++;
-
-                        parryTextColor.r = rand() % 128 + 128;
-                        parryTextColor.g = rand() % 128 + 128;
-                        parryTextColor.b = rand() % 128 + 128;
-                        parryTextColor.a = 255;
-                    } else {
-                        // Only take hit if not dashing and not parrying
-                        AudioManager::getInstance().playRandomHitSound();
-                        player->takeHit();
-                    }
-                }
-            }
-
-            // Handle player attacks hitting enemy
-            if (player->isAttacking) {
-                SDL_Rect playerAttackBox = player->getAttackHitbox();
-                SDL_Rect enemyCollider = enemy->getCollider();
-
-                if (SDL_HasIntersection(&playerAttackBox, &enemyCollider) &&
-                    !enemy->isTakingHit() && !enemy->isPermanentlyDisabled) {
-                    AudioManager::getInstance().playRandomHitSound();
-                    enemy->takeHit();
-                    // Increment both game and player defeat counts
-                    defeatedEnemyCount++;
-                    player->incrementEnemiesDefeated();
-                }
-            }
         }
     }
 
-    // Play miss sound for player attacks that don't hit anything
-    if (player && player->isAttacking && player->getCurrentFrame() == 0) {
-        bool hitSomething = false;
-        SDL_Rect playerAttackBox = player->getAttackHitbox();
+    // Resolve all attack hitboxes in one pass, then react to the outcome
+    combatEvents.clear();
+    Combat::resolve(player, enemies, combatEvents);
+    handleCombatEvents();
 
-        for (Enemy* enemy : enemies) {
-            if (enemy && !enemy->isPermanentlyDisabled) {
-                SDL_Rect enemyCollider = enemy->getCollider();
-                if (SDL_HasIntersection(&playerAttackBox, &enemyCollider)) {
-                    hitSomething = true;
-                    break;
-                }
-            }
-        }
-
-        if (!hitSomething) {
-            AudioManager::getInstance().playMissSound();
+    // One kill away from the mastery emote: start decoding its sheet and sounds
+    if (defeatedEnemyCount == 4) {
+        masteryTexture.prefetch();
+        for (const char* sound : MASTERY_SOUND_PATHS) {
+            AssetLoader::getInstance().queue(sound, ASSET_SOUND);
         }
     }
 
     // Update mastery animation if player defeats 5 enemies and is alive
     if (defeatedEnemyCount == 5 && !showMasteryAnimation && player && !player->permanentlyDisabled) {
         showMasteryAnimation = true;
-        masteryStartTime = SDL_GetTicks();
+        masteryStartTime = GameClock::getInstance().now();
         masteryFrame = 0;
+        masteryTimer = TimerWheel::getInstance().schedule((MASTERY_TOTAL_FRAMES - 1) * MASTERY_FRAME_DURATION, [this]() { endMastery(); });
         // Play both mastery sound effects
-        AudioManager::getInstance().playSoundEffect("audio/mastery_emote_tier5.mp3");
-        AudioManager::getInstance().playSoundEffect("audio/death-is-like-the-wind-always-by-my-side-101soundboards.mp3");
-    }
-
-    // Update mastery animation frames
-    if (showMasteryAnimation) {
-        Uint32 currentTime = SDL_GetTicks();
-        Uint32 elapsedTime = currentTime - masteryStartTime;
-        int expectedFrame = (elapsedTime / MASTERY_FRAME_DURATION) % MASTERY_TOTAL_FRAMES;
-
-        if (expectedFrame != masteryFrame) {
-            masteryFrame = expectedFrame;
-            if (masteryFrame >= MASTERY_TOTAL_FRAMES - 1) {
-                showMasteryAnimation = false;
-            }
+        for (const char* sound : MASTERY_SOUND_PATHS) {
+            AudioManager::getInstance().playSoundEffect(sound);
         }
     }
 
-    // Update parry text timer
-    if (showParryText && SDL_GetTicks() - parryTextStartTime >= PARRY_TEXT_DURATION) {
-        showParryText = false;
+    // Update mastery animation frames (the mastery timer hides it on the last frame)
+    if (showMasteryAnimation) {
+        Uint32 elapsedTime = GameClock::getInstance().now() - masteryStartTime;
+        masteryFrame = std::min<int>(elapsedTime / MASTERY_FRAME_DURATION, MASTERY_TOTAL_FRAMES - 1);
     }
 
     // Start timer when reaching 10 defeats if not already started
     if (!hasStartedTimer && defeatedEnemyCount >= 10) {
         hasStartedTimer = true;
         timerStarted = true;
-        timerStartTime = SDL_GetTicks();
-    }
+        timerStartTime = GameClock::getInstance().now();
+        StatsStore::getInstance().recordTenKills(timerStartTime - runStartTime);
 
-    // End game when timer runs out (only if timer has started)
-    // Update timer only if it's started and player is alive
-    if (timerStarted && !player->permanentlyDisabled && SDL_GetTicks() - timerStartTime >= TIMER_DURATION) {
-        isPaused = true;
-        showEndGameScreen = true;
-        AudioManager::getInstance().pauseMusic();
+        // End game when timer runs out (only if the player is still alive)
+        TimerWheel& timers = TimerWheel::getInstance();
+        timers.cancel(roundTimer);
+        roundTimer = timers.schedule(TIMER_DURATION, [this]() { endRound(); });
     }
 
-    // Update death count when player dies
+    // Decide what is visible now that everything has moved
+    cullEntities();
+
+    // Count the death once; the stats writer saves it in the background
     if (player && player->permanentlyDisabled && !player->deathCountUpdated) {
-        // Read current death count
-        std::ifstream deathFile("deathCount.txt");
-        int deathCount = 0;
-        if (deathFile.is_open()) {
-            deathFile >> deathCount;
-            deathFile.close();
+        StatsStore& stats = StatsStore::getInstance();
+        Uint32 survived = GameClock::getInstance().now() - runStartTime;
+        stats.addDeath();
+        stats.recordSurvivalTime(survived);
+        Telemetry::getInstance().record(TelemetryFormat::EVENT_DEATH, static_cast<int>(survived), player->getX(), player->getY());
+        stats.save();
+        player->deathCountUpdated = true;
+    }
+}
+
+void Game::render() {
+    // No scene target: the renderer's logical size does the scaling
+    if (!sceneTarget) {
+        composeFrame();
+        SDL_RenderPresent(renderer);
+        return;
+    }
+
+    // Paused screens are static: keep the frame already in the scene target instead of redrawing
+    if (!isPaused || !pauseFrameValid) {
+        SDL_SetRenderTarget(renderer, sceneTarget);
+        composeFrame();
+        SDL_SetRenderTarget(renderer, NULL);
+        pauseFrameValid = isPaused;
+    }
+
+    presentScene();
+}
+
+void Game::presentScene() {
+    // Upscale the finished frame to the window once, letterboxed in black
+    SDL_Rect presentRect = getPresentRect();
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+    SDL_RenderClear(renderer);
+    SDL_RenderCopy(renderer, sceneTarget, NULL, &presentRect);
+    SDL_RenderPresent(renderer);
+}
+
+bool Game::loadAssets() {
+    AssetLoader& loader = AssetLoader::getInstance();
+
+    // Only what the first frames need; rarely used assets load on demand or are prefetched later.
+    // Biggest files first so the long decodes overlap the short ones
+    loader.queue("assets/instruction.png", ASSET_TEXTURE);
+    const char* characterSheets[] = { "assets/Idle.png", "assets/Run.png", "assets/Attack.png",
+                                      "assets/Take Hit.png", "assets/Death.png", "assets/Dash.png" };
+    for (const char* sheet : characterSheets) {
+        loader.queue(sheet, ASSET_SURFACE);
+    }
+    for (const std::string& effect : AudioManager::getInstance().getEffectPaths()) {
+        loader.queue(effect.c_str(), ASSET_SOUND);
+    }
+    const char* textures[] = { "assets/Tileset.png", "assets/Decors.png",
+                               "assets/BG1.png", "assets/BG2.png", "assets/BG3.png" };
+    for (const char* texture : textures) {
+        loader.queue(texture, ASSET_TEXTURE);
+    }
+
+    Uint32 loadStart = SDL_GetTicks();
+    if (!loader.start()) return true;  // Everything loads from disk on demand instead
+
+    SDL_Texture* loadingText = nullptr;
+    SDL_Surface* textSurface = TTF_RenderText_Blended(font, "Loading...", SDL_Color{255, 255, 255, 255});
+    if (textSurface) {
+        loadingText = SDL_CreateTextureFromSurface(renderer, textSurface);
+        SDL_FreeSurface(textSurface);
+    }
+
+    // Keep the window alive and show progress while the workers decode
+    bool quit = false;
+    while (!loader.update()) {
+        SDL_Event event;
+        while (SDL_PollEvent(&event)) {
+            if (event.type == SDL_QUIT) quit = true;
         }
+        if (quit) break;
 
-        // Increment and write back
-        deathCount++;
-        std::ofstream outFile("deathCount.txt");
-        if (outFile.is_open()) {
-            outFile << deathCount;
-            outFile.close();
+        if (sceneTarget) SDL_SetRenderTarget(renderer, sceneTarget);
+        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+        SDL_RenderClear(renderer);
+
+        const int barWidth = SCREEN_WIDTH / 2;
+        const int barHeight = 12;
+        SDL_Rect bar = { (SCREEN_WIDTH - barWidth) / 2, SCREEN_HEIGHT / 2 + 20, barWidth, barHeight };
+        if (loadingText) {
+            SDL_Rect textRect = { 0, 0, 0, 0 };
+            SDL_QueryTexture(loadingText, NULL, NULL, &textRect.w, &textRect.h);
+            textRect.x = (SCREEN_WIDTH - textRect.w) / 2;
+            textRect.y = bar.y - textRect.h - 10;
+            SDL_RenderCopy(renderer, loadingText, NULL, &textRect);
         }
+        SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
+        SDL_RenderDrawRect(renderer, &bar);
+        SDL_Rect fill = { bar.x + 2, bar.y + 2, int((bar.w - 4) * loader.getProgress()), bar.h - 4 };
+        SDL_RenderFillRect(renderer, &fill);
+
+        if (sceneTarget) {
+            SDL_SetRenderTarget(renderer, NULL);
+            presentScene();
+        } else {
+            SDL_RenderPresent(renderer);
+        }
+    }
 
-        player->deathCountUpdated = true;
+    if (loadingText) SDL_DestroyTexture(loadingText);
+    if (quit) {
+        loader.clear();
+        return false;
     }
+    std::cout << "Startup assets loaded in " << SDL_GetTicks() - loadStart << " ms" << std::endl;
+    return true;
 }
 
-void Game::render() {
+SDL_Rect Game::getPresentRect() const {
+    int outputW = SCREEN_WIDTH, outputH = SCREEN_HEIGHT;
+    SDL_GetRendererOutputSize(renderer, &outputW, &outputH);
+
+    SDL_Rect rect;
+    int scale = std::min(outputW / SCREEN_WIDTH, outputH / SCREEN_HEIGHT);
+    if (scale >= 1) {
+        rect.w = SCREEN_WIDTH * scale;
+        rect.h = SCREEN_HEIGHT * scale;
+    } else {
+        // Window smaller than the logical size: shrink, keeping the aspect ratio
+        float fit = std::min(float(outputW) / SCREEN_WIDTH, float(outputH) / SCREEN_HEIGHT);
+        rect.w = std::max(1, int(SCREEN_WIDTH * fit));
+        rect.h = std::max(1, int(SCREEN_HEIGHT * fit));
+    }
+    rect.x = (outputW - rect.w) / 2;
+    rect.y = (outputH - rect.h) / 2;
+    return rect;
+}
+
+void Game::windowToScene(int& x, int& y) const {
+    if (!sceneTarget) return;  // SDL already maps mouse events through the logical size
+
+    // Mouse events are in window points, which differ from output pixels on high-DPI displays
+    int windowW, windowH, outputW, outputH;
+    SDL_GetWindowSize(window, &windowW, &windowH);
+    SDL_GetRendererOutputSize(renderer, &outputW, &outputH);
+    if (windowW > 0 && windowH > 0) {
+        x = x * outputW / windowW;
+        y = y * outputH / windowH;
+    }
+
+    SDL_Rect rect = getPresentRect();
+    x = (x - rect.x) * SCREEN_WIDTH / rect.w;
+    y = (y - rect.y) * SCREEN_HEIGHT / rect.h;
+}
+
+void Game::toggleFullscreen() {
+    bool fullscreen = (SDL_GetWindowFlags(window) & SDL_WINDOW_FULLSCREEN_DESKTOP) != 0;
+    if (SDL_SetWindowFullscreen(window, fullscreen ? 0 : SDL_WINDOW_FULLSCREEN_DESKTOP) != 0) {
+        std::cout << "Failed to toggle fullscreen. Error: " << SDL_GetError() << std::endl;
+    }
+}
+
+void Game::composeFrame() {
+    RenderQueue& queue = RenderQueue::getInstance();
     SDL_RenderClear(renderer);
 
     // Draw all game elements first
@@ -590,20 +765,13 @@ void Game::render() {
                     textRect.x = (SCREEN_WIDTH - textRect.w) / 2;
                     textRect.y = (SCREEN_HEIGHT - textRect.h) / 2;
 
-                    SDL_RenderCopy(renderer, textTexture, NULL, &textRect);
-                    SDL_DestroyTexture(textTexture);
+                    queue.submitTransient(LAYER_END_SCREEN, textTexture, textRect);
                 }
                 SDL_FreeSurface(textSurface);
             }
 
-            // Read and render death count
-            std::ifstream deathFile("deathCount.txt");
-            int deathCount = 0;
-            if (deathFile.is_open()) {
-                deathFile >> deathCount;
-                deathFile.close();
-            }
-
+            // Render death count
+            int deathCount = StatsStore::getInstance().get().deaths;
             std::string deathText = "you died " + std::to_string(deathCount) + " times";
             SDL_Surface* deathSurface = TTF_RenderText_Blended(font, deathText.c_str(), textColor);
             if (deathSurface) {
@@ -615,8 +783,7 @@ void Game::render() {
                     deathRect.x = (SCREEN_WIDTH - deathRect.w) / 2;
                     deathRect.y = (SCREEN_HEIGHT - deathRect.h) / 2 + 40; // Position below main text
 
-                    SDL_RenderCopy(renderer, deathTexture, NULL, &deathRect);
-                    SDL_DestroyTexture(deathTexture);
+                    queue.submitTransient(LAYER_END_SCREEN, deathTexture, deathRect);
                 }
                 SDL_FreeSurface(deathSurface);
             }
@@ -632,21 +799,20 @@ void Game::render() {
                     clickRect.x = (SCREEN_WIDTH - clickRect.w) / 2;
                     clickRect.y = (SCREEN_HEIGHT - clickRect.h) / 2 + 80; // Position below death count
 
-                    SDL_RenderCopy(renderer, clickTexture, NULL, &clickRect);
-                    SDL_DestroyTexture(clickTexture);
+                    queue.submitTransient(LAYER_END_SCREEN, clickTexture, clickRect);
                 }
                 SDL_FreeSurface(clickSurface);
             }
         }
 
-        SDL_RenderPresent(renderer);
+        queue.execute();
         return;
     }
 
     // 1. Render background layers from back to front
     if (backgroundTexture) {
         SDL_Rect destRect = {0, 0, SCREEN_WIDTH, SCREEN_HEIGHT};
-        SDL_RenderCopy(renderer, backgroundTexture, NULL, &destRect);
+        queue.submit(LAYER_BACKGROUND, backgroundTexture, nullptr, destRect);
     }
 
     // 2. Render middle layer (foreground) with parallax
@@ -659,12 +825,12 @@ void Game::render() {
             SCREEN_HEIGHT
         };
         SDL_Rect destRect = {0, 0, SCREEN_WIDTH, SCREEN_HEIGHT};
-        SDL_RenderCopy(renderer, foregroundTexture, &srcRect, &destRect);
+        queue.submit(LAYER_BACKGROUND, foregroundTexture, &srcRect, destRect);
 
         if (srcRect.x > 0) {
             SDL_Rect wrapSrcRect = {0, 0, srcRect.x, SCREEN_HEIGHT};
             SDL_Rect wrapDestRect = {SCREEN_WIDTH - srcRect.x, 0, srcRect.x, SCREEN_HEIGHT};
-            SDL_RenderCopy(renderer, foregroundTexture, &wrapSrcRect, &wrapDestRect);
+            queue.submit(LAYER_BACKGROUND, foregroundTexture, &wrapSrcRect, wrapDestRect);
         }
     }
 
@@ -678,12 +844,12 @@ void Game::render() {
             SCREEN_HEIGHT
         };
         SDL_Rect destRect = {0, 0, SCREEN_WIDTH, SCREEN_HEIGHT};
-        SDL_RenderCopy(renderer, closestTexture, &srcRect, &destRect);
+        queue.submit(LAYER_BACKGROUND, closestTexture, &srcRect, destRect);
 
         if (srcRect.x > 0) {
             SDL_Rect wrapSrcRect = {0, 0, srcRect.x, SCREEN_HEIGHT};
             SDL_Rect wrapDestRect = {SCREEN_WIDTH - srcRect.x, 0, srcRect.x, SCREEN_HEIGHT};
-            SDL_RenderCopy(renderer, closestTexture, &wrapSrcRect, &wrapDestRect);
+            queue.submit(LAYER_BACKGROUND, closestTexture, &wrapSrcRect, wrapDestRect);
         }
     }
 
@@ -692,19 +858,21 @@ void Game::render() {
         tileMap->render(cameraX, cameraY);
     }
 
-    // 5. Render game objects
+    // 5. Render game objects, between their last two step positions so motion
+    // stays smooth when frames are presented faster than the 60 Hz simulation
+    double stepFraction = GameClock::getInstance().stepFraction();
     if (player && player->getX() >= 0 && player->getY() >= 0) {
-        int renderX = player->getX() - cameraX;
-        int renderY = player->getY() - cameraY;
+        int renderX = player->getRenderX(stepFraction) - cameraX;
+        int renderY = player->getRenderY(stepFraction) - cameraY;
         // Only render the sprite here, hitboxes will be drawn later
         player->renderSprite(renderX, renderY);
     }
 
-    // Render all enemies
+    // Render all enemies the culling stage left on screen
     for (Enemy* enemy : enemies) {
-        if (enemy && enemy->getX() >= 0 && enemy->getY() >= 0) {
-            int renderX = enemy->getX() - cameraX;
-            int renderY = enemy->getY() - cameraY;
+        if (enemy && enemy->isOnScreen()) {
+            int renderX = enemy->getRenderX(stepFraction) - cameraX;
+            int renderY = enemy->getRenderY(stepFraction) - cameraY;
             enemy->render(renderX, renderY);
         }
     }
@@ -725,7 +893,7 @@ void Game::render() {
             textRect.x = (SCREEN_WIDTH - textRect.w) / 2;
             textRect.y = 20;
 
-            SDL_RenderCopy(renderer, textTexture, NULL, &textRect);
+            queue.submitTransient(LAYER_HUD, textTexture, textRect);
 
             // Render parry counter
             std::string parryText = "PARRIED: " + std::to_string(successfulParryCount);
@@ -739,11 +907,11 @@ void Game::render() {
                 parryCountRect.x = (SCREEN_WIDTH - parryCountRect.w) / 2;
                 parryCountRect.y = textRect.y + textRect.h + 10;
 
-                SDL_RenderCopy(renderer, parryTexture, NULL, &parryCountRect);
+                queue.submitTransient(LAYER_HUD, parryTexture, parryCountRect);
 
                 // Only render countdown timer if more than 10 enemies defeated
                 if (timerStarted && defeatedEnemyCount >= 10) {
-                    Uint32 elapsedTime = SDL_GetTicks() - timerStartTime;
+                    Uint32 elapsedTime = GameClock::getInstance().now() - timerStartTime;
                     Uint32 remainingTime = (elapsedTime >= TIMER_DURATION) ? 0 : TIMER_DURATION - elapsedTime;
 
                     int minutes = (remainingTime / 1000) / 60;
@@ -762,19 +930,16 @@ void Game::render() {
                         timerRect.x = (SCREEN_WIDTH - timerRect.w) / 2;
                         timerRect.y = parryCountRect.y + parryCountRect.h + 10;
 
-                        SDL_RenderCopy(renderer, timerTexture, NULL, &timerRect);
+                        queue.submitTransient(LAYER_HUD, timerTexture, timerRect);
 
                         SDL_FreeSurface(timerSurface);
-                        SDL_DestroyTexture(timerTexture);
                     }
                 }
 
                 SDL_FreeSurface(parrySurface);
-                SDL_DestroyTexture(parryTexture);
             }
 
             SDL_FreeSurface(textSurface);
-            SDL_DestroyTexture(textTexture);
         }
 
 
@@ -786,7 +951,7 @@ void Game::render() {
             currentTextSize = std::min(currentTextSize, 120); // Cap maximum size at 120
 
             // Create a larger font for the parry text
-            TTF_Font* largeFont = TTF_OpenFont("font/Jacquard_12/Jacquard12-Regular.ttf", currentTextSize);
+            TTF_Font* largeFont = openGameFont(currentTextSize);
             if (largeFont) {
                 SDL_Surface* parrySurface = TTF_RenderText_Solid(largeFont, "PARRY!?", parryTextColor);
                 if (parrySurface) {
@@ -798,10 +963,9 @@ void Game::render() {
                     parryRect.x = (SCREEN_WIDTH - parryRect.w) / 2;
                     parryRect.y = (SCREEN_HEIGHT / 2) - 50 - parryRect.h/2; // Center vertically with 50px offset
 
-                    SDL_RenderCopy(renderer, parryTexture, NULL, &parryRect);
+                    queue.submitTransient(LAYER_HUD, parryTexture, parryRect);
 
                     SDL_FreeSurface(parrySurface);
-                    SDL_DestroyTexture(parryTexture);
                 }
                 TTF_CloseFont(largeFont);
             }
@@ -811,10 +975,10 @@ void Game::render() {
     // Render cooldown indicators in top right corner
     if (font) {
         SDL_Color textColor = {255, 255, 255, 255}; // White color
-        TTF_Font* smallFont = TTF_OpenFont("font/Jacquard_12/Jacquard12-Regular.ttf", 24);
+        TTF_Font* smallFont = openGameFont(24);
         if (smallFont && player) {
             int yOffset = 20;
-            Uint32 currentTime = SDL_GetTicks();
+            Uint32 currentTime = GameClock::getInstance().now();
 
             // Attack cooldown
             std::string attackIndicator = "ATTACK : ";
@@ -857,9 +1021,8 @@ void Game::render() {
                     rect.h = surface->h;
                     rect.x = SCREEN_WIDTH - rect.w - 20;
                     rect.y = yOffset;
-                    SDL_RenderCopy(renderer, texture, NULL, &rect);
+                    queue.submitTransient(LAYER_HUD, texture, rect);
                     SDL_FreeSurface(surface);
-                    SDL_DestroyTexture(texture);
                     yOffset += rect.h + 5;
                 }
             }
@@ -869,27 +1032,22 @@ void Game::render() {
 
     // 6. Render hitboxes on top of everything
     if (player && player->getX() >= 0 && player->getY() >= 0) {
-        int renderX = player->getX() - cameraX;
-        int renderY = player->getY() - cameraY;
+        int renderX = player->getRenderX(stepFraction) - cameraX;
+        int renderY = player->getRenderY(stepFraction) - cameraY;
         player->renderHitboxes(renderX, renderY);
     }
 
     // Render fade overlay on top of everything if active
     if (isFading) {
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-        SDL_SetRenderDrawColor(renderer, 0, 0, 0, fadeAlpha);
-        SDL_Rect fadeRect = {-cameraX, -cameraY, MAP_COLS * TILE_SIZE, MAP_ROWS * TILE_SIZE};
-        SDL_RenderFillRect(renderer, &fadeRect);
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+        SDL_Rect fadeRect = {-cameraX, -cameraY, tileMap->getWidth(), tileMap->getHeight()};
+        queue.submitFill(LAYER_FADE, fadeRect, SDL_Color{ 0, 0, 0, fadeAlpha });
     }
 
     // Draw end game screen overlay and text if active - rendered last to appear on top of everything
     if (showEndGameScreen && font) {
         // Create semi-transparent black overlay
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 200);
         SDL_Rect fullscreen = {0, 0, SCREEN_WIDTH, SCREEN_HEIGHT};
-        SDL_RenderFillRect(renderer, &fullscreen);
+        queue.submitFill(LAYER_END_SCREEN, fullscreen, SDL_Color{ 0, 0, 0, 200 });
 
         // Render "thanks for the suffering <3" text
         TTF_SetFontSize(font, 48);
@@ -904,16 +1062,15 @@ void Game::render() {
                     textSurface->w,
                     textSurface->h
                 };
-                SDL_RenderCopy(renderer, textTexture, NULL, &textRect);
-                SDL_DestroyTexture(textTexture);
+                queue.submitTransient(LAYER_END_SCREEN, textTexture, textRect);
             }
             SDL_FreeSurface(textSurface);
         }
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
     }
 
     // Render mastery animation if active (and not during death or pause)
-    if (showMasteryAnimation && masteryTexture && !showDeathText && !isPaused) {
+    SDL_Texture* mastery = (showMasteryAnimation && !showDeathText && !isPaused) ? masteryTexture.get() : nullptr;
+    if (mastery) {
         const MasteryFrame& frame = MASTERY_FRAMES[masteryFrame];
 
         SDL_Rect srcRect = {
@@ -925,25 +1082,26 @@ void Game::render() {
 
         // Center the mastery animation above the player with 1.5x scaling
         SDL_Rect destRect = {
-            player->getX() - cameraX + (player->destRect.w - (int)(frame.w * 1.5f)) / 2,
-            player->getY() - cameraY - (int)(frame.h * 1.5f) - 20,  // Position above player with 20px gap
+            player->getRenderX(stepFraction) - cameraX + (player->destRect.w - (int)(frame.w * 1.5f)) / 2,
+            player->getRenderY(stepFraction) - cameraY - (int)(frame.h * 1.5f) - 20,  // Position above player with 20px gap
             (int)(frame.w * 1.5f),
             (int)(frame.h * 1.5f)
         };
 
-        SDL_RenderCopy(renderer, masteryTexture, &srcRect, &destRect);
+        if (isInView({ destRect.x + cameraX, destRect.y + cameraY, destRect.w, destRect.h })) {
+            queue.submit(LAYER_EFFECTS, mastery, &srcRect, destRect);
+        }
     }
 
     // Render the "YOU DIED" text and reset prompt after fade effect
     if (showDeathText && font) {
         // Render YOU DIED text
-        TTF_Font* deathFont = TTF_OpenFont("font/Jacquard_12/Jacquard12-Regular.ttf", 72);
+        TTF_Font* deathFont = openGameFont(72);
         if (deathFont) {
             SDL_Color deathTextColor = {255, 0, 0, deathTextAlpha};  // Red color with fading alpha
             SDL_Surface* deathSurface = TTF_RenderText_Solid(deathFont, "YOU DIED", deathTextColor);
             if (deathSurface) {
                 SDL_Texture* deathTexture = SDL_CreateTextureFromSurface(renderer, deathSurface);
-                SDL_SetTextureAlphaMod(deathTexture, deathTextAlpha);
 
                 SDL_Rect deathRect;
                 deathRect.w = deathSurface->w;
@@ -951,7 +1109,7 @@ void Game::render() {
                 deathRect.x = (SCREEN_WIDTH - deathRect.w) / 2;
                 deathRect.y = (SCREEN_HEIGHT - deathRect.h) / 2;
 
-                SDL_RenderCopy(renderer, deathTexture, NULL, &deathRect);
+                queue.submitTransient(LAYER_DEATH_TEXT, deathTexture, deathRect, SDL_Color{ 255, 255, 255, deathTextAlpha });
 
                 // Only show reset prompt when YOU DIED is fully visible
                 if (deathTextAlpha >= 255) {
@@ -966,15 +1124,13 @@ void Game::render() {
                         resetRect.x = (SCREEN_WIDTH - resetRect.w) / 2;
                         resetRect.y = deathRect.y + deathRect.h + 20; // 20 pixels below YOU DIED text
 
-                        SDL_RenderCopy(renderer, resetTexture, NULL, &resetRect);
+                        queue.submitTransient(LAYER_DEATH_TEXT, resetTexture, resetRect);
 
                         SDL_FreeSurface(resetSurface);
-                        SDL_DestroyTexture(resetTexture);
                     }
                 }
 
                 SDL_FreeSurface(deathSurface);
-                SDL_DestroyTexture(deathTexture);
             }
             TTF_CloseFont(deathFont);
         }
@@ -983,15 +1139,15 @@ void Game::render() {
     // Render pause screen overlay if game is paused
     if (isPaused) {
         // First draw a semi-transparent black overlay
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 192); // 75% opacity black
         SDL_Rect fullscreenRect = {0, 0, SCREEN_WIDTH, SCREEN_HEIGHT};
-        SDL_RenderFillRect(renderer, &fullscreenRect);
+        queue.submitFill(LAYER_PAUSE_BACKDROP, fullscreenRect, SDL_Color{ 0, 0, 0, 192 });
 
-        if (pauseScreenTexture) {
+        // The opaque start screen covers the pause art, so it isn't loaded until a real pause
+        SDL_Texture* pauseArt = showInitialInstructions ? nullptr : pauseScreenTexture.get();
+        if (pauseArt) {
             // Calculate dimensions to maintain aspect ratio while filling screen
             int imgW, imgH;
-            SDL_QueryTexture(pauseScreenTexture, NULL, NULL, &imgW, &imgH);
+            SDL_QueryTexture(pauseArt, NULL, NULL, &imgW, &imgH);
             float imgAspect = (float)imgW / imgH;
             float screenAspect = (float)SCREEN_WIDTH / SCREEN_HEIGHT;
 
@@ -1010,12 +1166,12 @@ void Game::render() {
                 pauseRect.y = 0;
             }
 
-            SDL_RenderCopy(renderer, pauseScreenTexture, NULL, &pauseRect);
+            queue.submit(LAYER_PAUSE_BACKDROP, pauseArt, nullptr, pauseRect);
         }
 
         // Render "PAUSED" text and subtitle
         if (font) {
-            TTF_Font* pauseFont = TTF_OpenFont("font/Jacquard_12/Jacquard12-Regular.ttf", 72);
+            TTF_Font* pauseFont = openGameFont(72);
             if (pauseFont) {
                 SDL_Color pauseTextColor = {255, 0, 0, 255}; // Red color
                 SDL_Surface* pauseSurface = TTF_RenderText_Solid(pauseFont, "PAUSED", pauseTextColor);
@@ -1028,10 +1184,10 @@ void Game::render() {
                     textRect.x = (SCREEN_WIDTH - textRect.w) / 2;
                     textRect.y = (SCREEN_HEIGHT - textRect.h) / 2;
 
-                    SDL_RenderCopy(renderer, pauseTexture, NULL, &textRect);
+                    queue.submitTransient(LAYER_PAUSE_TEXT, pauseTexture, textRect);
 
                     // Add "Press ESC" subtitle in blue
-                    TTF_Font* smallFont = TTF_OpenFont("font/Jacquard_12/Jacquard12-Regular.ttf", 36);
+                    TTF_Font* smallFont = openGameFont(36);
                     if (smallFont) {
                         SDL_Color escTextColor = {0, 0, 255, 255}; // Blue color
                         SDL_Surface* escSurface = TTF_RenderText_Solid(smallFont, "Press ESC", escTextColor);
@@ -1044,21 +1200,18 @@ void Game::render() {
                             escRect.x = (SCREEN_WIDTH - escRect.w) / 2;
                             escRect.y = textRect.y + textRect.h + 20; // 20 pixels below PAUSED text
 
-                            SDL_RenderCopy(renderer, escTexture, NULL, &escRect);
+                            queue.submitTransient(LAYER_PAUSE_TEXT, escTexture, escRect);
 
                             SDL_FreeSurface(escSurface);
-                            SDL_DestroyTexture(escTexture);
                         }
                         TTF_CloseFont(smallFont);
                     }
 
                     SDL_FreeSurface(pauseSurface);
-                    SDL_DestroyTexture(pauseTexture);
                 }
                 TTF_CloseFont(pauseFont);
             }
         }
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
     }
 
     // Present the rendered frame
@@ -1070,7 +1223,7 @@ void Game::render() {
             600,
             400
         };
-        SDL_RenderCopy(renderer, instructionsTexture, NULL, NULL);
+        queue.submit(LAYER_INSTRUCTIONS, instructionsTexture, nullptr, SDL_Rect{ 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT });
     }
     if (font && !showDeathText) {
     SDL_Color textColor = {255, 255, 255, 255}; // White color (R,G,B,A)
@@ -1084,27 +1237,24 @@ void Game::render() {
         textRect.x = 0;
         textRect.y = 50;  // 50 pixels from top
 
-        SDL_RenderCopy(renderer, textTexture, NULL, &textRect);
+        queue.submitTransient(LAYER_PROMPT, textTexture, textRect);
 
         SDL_FreeSurface(textSurface);
-        SDL_DestroyTexture(textTexture);
     }
 }
     // 8. Present renderer
     // Show initial instructions
     if (showInitialInstructions && instructionsTexture) {
         // Semi-transparent black overlay
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 192);
         SDL_Rect fullscreenRect = {0, 0, SCREEN_WIDTH, SCREEN_HEIGHT};
-        SDL_RenderFillRect(renderer, &fullscreenRect);
+        queue.submitFill(LAYER_START_BACKDROP, fullscreenRect, SDL_Color{ 0, 0, 0, 192 });
 
         // Render the instruction texture
-        SDL_RenderCopy(renderer, instructionsTexture, NULL, NULL);
+        queue.submit(LAYER_START_BACKDROP, instructionsTexture, nullptr, SDL_Rect{ 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT });
 
         // Add "Press Enter to start" text
         if (font) {
-            TTF_Font* startFont = TTF_OpenFont("font/Jacquard_12/Jacquard12-Regular.ttf", 36);
+            TTF_Font* startFont = openGameFont(36);
             if (startFont) {
                 SDL_Color startTextColor = {255, 255, 255, 255};
                 SDL_Surface* startSurface = TTF_RenderText_Solid(startFont, "Press Enter to start", startTextColor);
@@ -1117,21 +1267,23 @@ void Game::render() {
                     startRect.x = (SCREEN_WIDTH - startRect.w) / 2;
                     startRect.y = SCREEN_HEIGHT - 100;  // 100 pixels from bottom
 
-                    SDL_RenderCopy(renderer, startTexture, NULL, &startRect);
+                    queue.submitTransient(LAYER_START_TEXT, startTexture, startRect);
 
                     SDL_FreeSurface(startSurface);
-                    SDL_DestroyTexture(startTexture);
                 }
                 TTF_CloseFont(startFont);
             }
         }
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
     }
 
-    SDL_RenderPresent(renderer);
+    // Draw everything queued this frame in layer order
+    queue.execute();
 }
 
 void Game::clean() {
+    // Preloaded assets nobody took (or a load cut short by quitting)
+    AssetLoader::getInstance().clear();
+
     // Cleanup font before other resources
     if (font) {
         TTF_CloseFont(font);
@@ -1142,6 +1294,11 @@ void Game::clean() {
     // Cleanup audio before other resources
     AudioManager::getInstance().cleanup();
 
+    // Save this session's kills and parries, waiting for the writer to finish
+    StatsStore::getInstance().save();
+    StatsStore::getInstance().shutdown();
+    Telemetry::getInstance().shutdown();
+
     // Destroy textures - TextureManager::cleanUp() assumes it handles this
     TextureManager::cleanUp();
     delete player;
@@ -1150,10 +1307,19 @@ void Game::clean() {
         delete enemy;
     }
     enemies.clear();
+    delete enemyArchetype;
+    enemyArchetype = nullptr;
     delete tileMap;
     tileMap = nullptr;
+    delete spriteAtlas;
+    spriteAtlas = nullptr;
+    if (sceneTarget) {
+        SDL_DestroyTexture(sceneTarget);
+        sceneTarget = nullptr;
+    }
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
+    AssetPack::getInstance().close();  // After everything streaming from it is freed
     IMG_Quit();
     SDL_Quit();
     std::cout << "Game cleaned" << std::endl;
@@ -1163,7 +1329,122 @@ bool Game::running() {
     return isRunning;
 }
 
+void Game::setPaused(bool paused) {
+    isPaused = paused;
+    pauseFrameValid = false;  // Whatever is on screen changes with the pause state
+    GameClock::getInstance().setPaused(paused);
+}
+
+void Game::startFadeEffect() {
+    isFading = true;
+    fadeStartTime = GameClock::getInstance().now();
+    fadeAlpha = 0;
+
+    TimerWheel& timers = TimerWheel::getInstance();
+    timers.cancel(fadeTimer);
+    fadeTimer = timers.schedule(FADE_DURATION, [this]() { endFade(); });
+}
+
+void Game::showParryEffect() {
+    showParryText = true;
+    parryTextStartTime = GameClock::getInstance().now();
+
+    TimerWheel& timers = TimerWheel::getInstance();
+    timers.cancel(parryTextTimer);
+    parryTextTimer = timers.schedule(PARRY_TEXT_DURATION, [this]() { endParryText(); });
+}
+
+void Game::endParryText() {
+    parryTextTimer = TimerWheel::INVALID_TIMER;
+    showParryText = false;
+}
+
+void Game::endMastery() {
+    masteryTimer = TimerWheel::INVALID_TIMER;
+    showMasteryAnimation = false;
+}
+
+void Game::endFade() {
+    fadeTimer = TimerWheel::INVALID_TIMER;
+    fadeAlpha = 255;  // Keep screen black
+}
+
+void Game::endRound() {
+    roundTimer = TimerWheel::INVALID_TIMER;
+    if (timerStarted && player && !player->permanentlyDisabled) {
+        StatsStore& stats = StatsStore::getInstance();
+        stats.recordSurvivalTime(GameClock::getInstance().now() - runStartTime);
+        stats.save();
+        setPaused(true);
+        showEndGameScreen = true;
+        AudioManager::getInstance().pauseMusic();
+    }
+}
+
+void Game::cancelTimers() {
+    TimerWheel& timers = TimerWheel::getInstance();
+    timers.cancel(parryTextTimer);
+    timers.cancel(roundTimer);
+    timers.cancel(masteryTimer);
+    timers.cancel(fadeTimer);
+}
+
+void Game::handleCombatEvents() {
+    AudioManager& audio = AudioManager::getInstance();
+    Telemetry& telemetry = Telemetry::getInstance();
+
+    for (const Combat::CombatEvent& event : combatEvents) {
+        switch (event.type) {
+            case Combat::ENEMY_HIT:
+                audio.playRandomHitSound();
+                // Increment both game and player defeat counts
+                defeatedEnemyCount++;
+                player->incrementEnemiesDefeated();
+                StatsStore::getInstance().addKill();
+                if (event.enemy) {
+                    telemetry.record(TelemetryFormat::EVENT_KILL, 0, event.enemy->getX(), event.enemy->getY());
+                }
+                break;
+            case Combat::ATTACK_MISSED:
+                audio.playMissSound();
+                break;
+            case Combat::PARRY:
+            case Combat::DASH_PARRY:
+                audio.playRandomParrySound();
+                showParryEffect();
+                successfulParryCount++;
+                StatsStore::getInstance().addParry();
+                telemetry.record(TelemetryFormat::EVENT_PARRY, event.type == Combat::DASH_PARRY ? 1 : 0, player->getX(), player->getY());
+
+                // Generate random bright color
+                parryTextColor.r = rand() % 128 + 128;
+                parryTextColor.g = rand() % 128 + 128;
+                parryTextColor.b = rand() % 128 + 128;
+                parryTextColor.a = 255;
+                break;
+            case Combat::PLAYER_HIT:
+                audio.playRandomHitSound();
+                break;
+        }
+    }
+}
+
+bool Game::isInView(const SDL_Rect& worldRect, int margin) const {
+    SDL_Rect view = { cameraX - margin, cameraY - margin, SCREEN_WIDTH + margin * 2, SCREEN_HEIGHT + margin * 2 };
+    return SDL_HasIntersection(&worldRect, &view) == SDL_TRUE;
+}
+
+void Game::cullEntities() {
+    for (Enemy* enemy : enemies) {
+        if (enemy) {
+            enemy->setOnScreen(isInView(enemy->destRect, CULL_MARGIN));
+        }
+    }
+}
+
 void Game::spawnRandomEnemy() {
+    if (!enemyArchetype || !enemyArchetype->isValid()) return;
+
     static std::random_device rd;
     static std::mt19937 gen(rd());
     std::uniform_int_distribution<> dist(100, SCREEN_WIDTH - 100); // Use screen width for spawning
@@ -1171,8 +1452,7 @@ void Game::spawnRandomEnemy() {
     // Random x position anywhere on screen
     int spawnX = dist(gen);
 
-    Enemy* newEnemy = new Enemy("assets/Idle.png", "assets/Run.png", "assets/Attack.png",
-                               "assets/Take Hit.png", "assets/Death.png", spawnX, 0, 1.0f);
+    Enemy* newEnemy = new Enemy(enemyArchetype, spawnX, 0, 1.0f);
     if (newEnemy) {
         enemies.push_back(newEnemy);
     }
@@ -1180,9 +1460,12 @@ void Game::spawnRandomEnemy() {
 
 void Game::restart() {
     // Play restart sound
-    AudioManager::getInstance().playSoundEffect("audio/ahhyooaaawhoaaa.mp3");
+    AudioManager::getInstance().playSoundEffect(RESTART_SOUND_PATH);
 
     // Reset game state variables
+    cancelTimers();
+    showParryText = false;
+    showMasteryAnimation = false;
     defeatedEnemyCount = 0;
     successfulParryCount = 0;
     firstWaveDefeated = false;
@@ -1193,6 +1476,8 @@ void Game::restart() {
     fadeAlpha = 0;
     showDeathText = false;
     deathTextAlpha = 0;
+    runStartTime = GameClock::getInstance().now();
+    Telemetry::getInstance().record(TelemetryFormat::EVENT_RESTART);
 
     // Clear existing enemies
     for (Enemy* enemy : enemies) {
@@ -1218,3 +1503,236 @@ void Game::restart() {
     AudioManager::getInstance().playMusic("audio/medieval-star-188280.mp3");
     AudioManager::getInstance().setMusicVolume(64);
 }
+
+bool Game::saveSnapshot(const char* path) {
+    using namespace SnapshotFormat;
+    if (!player) return false;
+
+    const TimerWheel& timers = TimerWheel::getInstance();
+    auto timeLeft = [&timers](TimerWheel::TimerId id) {
+        return timers.isPending(id) ? timers.remaining(id) : NO_TIMER;
+    };
+
+    std::vector<const Enemy*> saved;
+    for (const Enemy* enemy : enemies) {
+        if (enemy) saved.push_back(enemy);
+    }
+    if (saved.size() > MAX_ENEMIES) {
+        std::cout << "Too many enemies for a snapshot (" << saved.size() << ", at most " << MAX_ENEMIES << ")" << std::endl;
+        return false;
+    }
+
+    WorldState world = WorldState();
+    world.gameTime = GameClock::getInstance().nowPrecise();
+    world.enemyCount = static_cast<std::uint32_t>(saved.size());
+    world.cameraX = cameraX;
+    world.cameraY = cameraY;
+    world.defeatedEnemyCount = defeatedEnemyCount;
+    world.successfulParryCount = successfulParryCount;
+    world.runStartTime = runStartTime;
+    world.firstWaveDefeated = firstWaveDefeated;
+    world.secondMusicStarted = secondMusicStarted;
+    world.lockCamera = lockCamera;
+    world.showParryText = showParryText;
+    world.parryTextStartTime = parryTextStartTime;
+    world.parryTextColor[0] = parryTextColor.r;
+    world.parryTextColor[1] = parryTextColor.g;
+    world.parryTextColor[2] = parryTextColor.b;
+    world.parryTextColor[3] = parryTextColor.a;
+    world.timerStarted = timerStarted;
+    world.hasStartedTimer = hasStartedTimer;
+    world.showMasteryAnimation = showMasteryAnimation;
+    world.isFading = isFading;
+    world.timerStartTime = timerStartTime;
+    world.masteryStartTime = masteryStartTime;
+    world.masteryFrame = masteryFrame;
+    world.fadeStartTime = fadeStartTime;
+    world.deathTextStartTime = deathTextStartTime;
+    world.fadeAlpha = fadeAlpha;
+    world.showDeathText = showDeathText;
+    world.deathTextAlpha = deathTextAlpha;
+    world.parryTextTimer = timeLeft(parryTextTimer);
+    world.roundTimer = timeLeft(roundTimer);
+    world.masteryTimer = timeLeft(masteryTimer);
+    world.fadeTimer = timeLeft(fadeTimer);
+
+    std::string music, next;
+    AudioManager::getInstance().getMusicState(music, next, world.musicPosition);
+    std::strncpy(world.musicPath, music.c_str(), PATH_SIZE - 1);
+    std::strncpy(world.nextTrack, next.c_str(), PATH_SIZE - 1);
+
+    // Body: world, player, then every enemy, back to back
+    std::vector<char> body(sizeof(WorldState) + sizeof(PlayerState) + saved.size() * sizeof(EnemyState));
+    char* out = body.data();
+    std::memcpy(out, &world, sizeof(world));
+    out += sizeof(world);
+    PlayerState playerState;
+    player->saveState(playerState);
+    std::memcpy(out, &playerState, sizeof(playerState));
+    out += sizeof(playerState);
+    for (const Enemy* enemy : saved) {
+        EnemyState enemyState;
+        enemy->saveState(enemyState);
+        std::memcpy(out, &enemyState, sizeof(enemyState));
+        out += sizeof(enemyState);
+    }
+
+    // Compressed only when that saves 1/8 or more, like pack entries
+    std::vector<char> compressed;
+    bool useLz4 = PackFormat::compressLz4(body.data(), body.size(), compressed) &&
+                  compressed.size() <= body.size() - body.size() / 8;
+
+    SnapshotHeader header;
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.compression = useLz4 ? PackFormat::COMPRESSION_LZ4 : PackFormat::COMPRESSION_NONE;
+    header.size = static_cast<std::uint32_t>(body.size());
+    header.storedSize = static_cast<std::uint32_t>(useLz4 ? compressed.size() : body.size());
+
+    std::ofstream output(path, std::ios::binary | std::ios::trunc);
+    output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    output.write(useLz4 ? compressed.data() : body.data(), header.storedSize);
+    output.flush();
+    if (!output) {
+        std::cout << "Failed to write snapshot: " << path << std::endl;
+        return false;
+    }
+    std::cout << "Saved snapshot " << path << " (" << saved.size() << " enemies, "
+              << sizeof(header) + header.storedSize << " bytes)" << std::endl;
+    return true;
+}
+
+bool Game::loadSnapshot(const char* path) {
+    using namespace SnapshotFormat;
+
+    // Read and check everything before touching the running game
+    std::ifstream input(path, std::ios::binary);
+    SnapshotHeader header;
+    if (!input.read(reinterpret_cast<char*>(&header), sizeof(header))
+        || std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION) {
+        std::cout << "Not a snapshot (or from another version): " << path << std::endl;
+        return false;
+    }
+
+    // Size the buffers only once the header's sizes are known to be sane
+    std::streamoff bodyStart = input.tellg();
+    input.seekg(0, std::ios::end);
+    std::streamoff remaining = input.tellg() - bodyStart;
+    input.seekg(bodyStart);
+    if (header.size < MIN_BODY_SIZE || header.size > MAX_BODY_SIZE ||
+        header.storedSize == 0 || header.storedSize > header.size || std::streamoff(header.storedSize) > remaining) {
+        std::cout << "Corrupt snapshot: " << path << std::endl;
+        return false;
+    }
+
+    std::vector<char> stored(header.storedSize);
+    std::vector<char> body(header.size);
+    bool valid = static_cast<bool>(input.read(stored.data(), stored.size()));
+    if (valid && header.compression == PackFormat::COMPRESSION_LZ4) {
+        valid = PackFormat::decompressLz4(stored.data(), stored.size(), body.data(), body.size());
+    } else if (valid) {
+        valid = header.compression == PackFormat::COMPRESSION_NONE && header.storedSize == header.size;
+        if (valid) body.swap(stored);
+    }
+
+    WorldState world;
+    PlayerState playerState;
+    std::vector<EnemyState> enemyStates;
+    if (valid) {
+        std::memcpy(&world, body.data(), sizeof(world));
+        std::memcpy(&playerState, body.data() + sizeof(world), sizeof(playerState));
+        valid = world.enemyCount <= MAX_ENEMIES &&
+                body.size() == MIN_BODY_SIZE + size_t(world.enemyCount) * sizeof(EnemyState) &&
+                std::isfinite(world.gameTime) && world.gameTime >= 0.0 &&
+                std::isfinite(world.musicPosition) &&
+                world.masteryFrame >= 0 && world.masteryFrame < MASTERY_TOTAL_FRAMES &&
+                GameObject::isValidState(playerState);
+    }
+    if (!valid) {
+        std::cout << "Corrupt snapshot: " << path << std::endl;
+        return false;
+    }
+    if (world.enemyCount > 0 && (!enemyArchetype || !enemyArchetype->isValid())) {
+        std::cout << "Can't load snapshot without the enemy sprites" << std::endl;
+        return false;
+    }
+    enemyStates.resize(world.enemyCount);
+    if (!enemyStates.empty()) {
+        std::memcpy(enemyStates.data(), body.data() + MIN_BODY_SIZE, enemyStates.size() * sizeof(EnemyState));
+    }
+    for (const EnemyState& enemyState : enemyStates) {
+        if (!Enemy::isValidState(enemyState, enemyArchetype)) {
+            std::cout << "Corrupt snapshot: " << path << std::endl;
+            return false;
+        }
+    }
+    world.musicPath[PATH_SIZE - 1] = '\0';
+    world.nextTrack[PATH_SIZE - 1] = '\0';
+
+    // Tear the current run down; the timer wheel then restarts at the restored time
+    cancelTimers();
+    for (Enemy* enemy : enemies) {
+        delete enemy;
+    }
+    enemies.clear();
+    delete player;
+    player = nullptr;
+    TimerWheel& timers = TimerWheel::getInstance();
+    timers.clear();
+    GameClock::getInstance().setTime(world.gameTime);
+
+    // Every state was checked above, so these loads can't be refused
+    player = new GameObject(50, 50, 50, 50);
+    player->setGameRef(this);
+    player->loadState(playerState);
+
+    for (const EnemyState& enemyState : enemyStates) {
+        Enemy* enemy = new Enemy(enemyArchetype, enemyState.x, enemyState.y, enemyState.scale);
+        enemy->loadState(enemyState);
+        enemies.push_back(enemy);
+    }
+
+    cameraX = world.cameraX;
+    cameraY = world.cameraY;
+    defeatedEnemyCount = world.defeatedEnemyCount;
+    successfulParryCount = world.successfulParryCount;
+    runStartTime = world.runStartTime;
+    firstWaveDefeated = world.firstWaveDefeated != 0;
+    secondMusicStarted = world.secondMusicStarted != 0;
+    lockCamera = world.lockCamera != 0;
+    showParryText = world.showParryText != 0;
+    parryTextStartTime = world.parryTextStartTime;
+    parryTextColor = { world.parryTextColor[0], world.parryTextColor[1], world.parryTextColor[2], world.parryTextColor[3] };
+    timerStarted = world.timerStarted != 0;
+    hasStartedTimer = world.hasStartedTimer != 0;
+    showMasteryAnimation = world.showMasteryAnimation != 0;
+    isFading = world.isFading != 0;
+    timerStartTime = world.timerStartTime;
+    masteryStartTime = world.masteryStartTime;
+    masteryFrame = world.masteryFrame;
+    fadeStartTime = world.fadeStartTime;
+    deathTextStartTime = world.deathTextStartTime;
+    fadeAlpha = world.fadeAlpha;
+    showDeathText = world.showDeathText != 0;
+    deathTextAlpha = world.deathTextAlpha;
+
+    if (world.parryTextTimer != NO_TIMER) parryTextTimer = timers.schedule(world.parryTextTimer, [this]() { endParryText(); });
+    if (world.roundTimer != NO_TIMER) roundTimer = timers.schedule(world.roundTimer, [this]() { endRound(); });
+    if (world.masteryTimer != NO_TIMER) masteryTimer = timers.schedule(world.masteryTimer, [this]() { endMastery(); });
+    if (world.fadeTimer != NO_TIMER) fadeTimer = timers.schedule(world.fadeTimer, [this]() { endFade(); });
+
+    // A snapshot always resumes straight into play
+    showInitialInstructions = false;
+    showInstructions = false;
+    showEndGameScreen = false;
+    setPaused(false);
+
+    AudioManager& audio = AudioManager::getInstance();
+    audio.restoreMusic(world.musicPath, world.nextTrack, world.musicPosition);
+    audio.setMusicVolume(64);
+    audio.resumeAllSounds();
+
+    cullEntities();
+    std::cout << "Loaded snapshot " << path << " (" << world.enemyCount << " enemies)" << std::endl;
+    return true;
+}
@@ -5,11 +5,17 @@
 #include <vector>
 #include <fstream>
 #include "AudioManager.h"
+#include "GameClock.h"
+#include "TimerWheel.h"
+#include "Combat.hpp"
+#include "AssetLoader.h"
 
 // Forward declarations
 class GameObject;
 class TileMap;
 class Enemy;
+class EnemyArchetype;
+class TextureAtlas;
 
 class Game {
 public:
@@ -28,32 +34,70 @@ public:
     // Returns true if game is running
     bool running();
 
-    // Map constants
-    static const int MAP_ROWS = 64;
-    static const int MAP_COLS = 64;
+    // Map constants (the map size comes from the level file, see TileMap)
     static const int TILE_SIZE = 16;
 
-    // Screen dimensions
+    // Logical screen dimensions: the whole game draws at this size and is scaled to the window
     static int SCREEN_WIDTH;
     static int SCREEN_HEIGHT;
 
     // Shared renderer
     static SDL_Renderer* renderer;
 
+    // Atlas page holding the character sprite sheets (nullptr if it failed to build)
+    static TextureAtlas* spriteAtlas;
+
     void spawnRandomEnemy();
-    void startFadeEffect() {
-        isFading = true;
-        fadeStartTime = SDL_GetTicks();
-        fadeAlpha = 0;
-    }
+    void startFadeEffect();
 
     void restart();
 
+    // Write the whole simulation (entities, timers, counters, camera, music) to a snapshot file
+    bool saveSnapshot(const char* path);
+    // Replace the running game with a saved snapshot; the game is left untouched if the file is bad
+    bool loadSnapshot(const char* path);
+
 private:
+    // Pause or resume gameplay, freezing the game clock along with it
+    void setPaused(bool paused);
+
+    // Queue and draw one full frame to the current render target (no present)
+    void composeFrame();
+    // Upscale the scene target into the window and present it
+    void presentScene();
+    // Decode the startup assets on worker threads behind a loading screen; false if the window was closed
+    bool loadAssets();
+    // Where the scene target lands in the window: integer scaled and centered
+    SDL_Rect getPresentRect() const;
+    // Map a window position (mouse) to logical screen coordinates
+    void windowToScene(int& x, int& y) const;
+    void toggleFullscreen();
+
+    // Show the PARRY!? text and schedule it to hide
+    void showParryEffect();
+    // Drop every pending game-level timer (restart)
+    void cancelTimers();
+    // Game-level timer callbacks
+    void endParryText();
+    void endMastery();
+    void endFade();
+    void endRound();
+    // Play sounds and update counters/UI for this tick's combat events
+    void handleCombatEvents();
+
+    // True if a world-space rectangle overlaps the camera view grown by margin
+    bool isInView(const SDL_Rect& worldRect, int margin = 0) const;
+    // Flag each enemy as on or off screen for rendering and animation
+    void cullEntities();
+    static const int CULL_MARGIN = 64;  // Pixels around the view still treated as visible
+    static const Uint32 FRAME_SPIKE_THRESHOLD = 50;  // ms; longer frames are logged to telemetry
+
     SDL_Window* window;
     bool isRunning;
     GameObject* player;
     std::vector<Enemy*> enemies;
+    EnemyArchetype* enemyArchetype;  // Clips and tuning shared by every spawned enemy
+    std::vector<Combat::CombatEvent> combatEvents;  // Reused every tick
     bool firstWaveDefeated;
     int defeatedEnemyCount;
     TileMap* tileMap;
@@ -72,30 +116,35 @@ private:
     SDL_Color parryTextColor;
     int parryTextSize;
     int successfulParryCount;
+    TimerWheel::TimerId parryTextTimer;
 
     // Timer properties
     bool timerStarted;
     Uint32 timerStartTime;
+    Uint32 runStartTime;  // Game time the current run began, for the survival stats
     static const Uint32 TIMER_DURATION = 142000; // 2:22 in milliseconds
     bool hasStartedTimer;
+    TimerWheel::TimerId roundTimer;
 
     // Mastery animation properties
     struct MasteryFrame {
         int x, y, w, h;
     };
     static const MasteryFrame MASTERY_FRAMES[30];
-    SDL_Texture* masteryTexture;
+    TextureHandle masteryTexture;  // Loaded when the emote comes close
     bool showMasteryAnimation;
     Uint32 masteryStartTime;
     int masteryFrame;
     static const int MASTERY_TOTAL_FRAMES = 30;
     static const Uint32 MASTERY_FRAME_DURATION = 100;
+    TimerWheel::TimerId masteryTimer;
 
     // Screen fade properties
     bool isFading;
     Uint32 fadeStartTime;
     static const Uint32 FADE_DURATION = 3000; // 3 seconds
     Uint8 fadeAlpha;
+    TimerWheel::TimerId fadeTimer;
 
     // Death text properties
     bool showDeathText;
@@ -105,11 +154,16 @@ private:
 
     bool canRestart;
     bool isPaused;
-    SDL_Texture* pauseScreenTexture;
+    TextureHandle pauseScreenTexture;  // Loaded on the first pause
 
     // Instructions screen properties
     bool showInstructions;
     SDL_Texture* instructionsTexture;
     bool showInitialInstructions;
     bool showEndGameScreen;
+
+    // Logical-size render target every frame is drawn into (nullptr = renderer logical size fallback)
+    SDL_Texture* sceneTarget;
+    // The scene target holds the paused frame; present it as-is until the game resumes
+    bool pauseFrameValid;
 };
@@ -0,0 +1,70 @@
+#include "GameClock.h"
+
+GameClock& GameClock::getInstance() {
+    static GameClock instance;
+    return instance;
+}
+
+GameClock::GameClock()
+    : frequency(SDL_GetPerformanceFrequency()),
+      lastCounter(SDL_GetPerformanceCounter()),
+      realTimeMs(0.0),
+      gameTimeMs(0.0),
+      deltaMs(0.0),
+      frameMs(0.0),
+      pendingMs(0.0),
+      timeScale(1.0),
+      fixedStepMs(0.0),
+      paused(false)
+{ }
+
+void GameClock::beginFrame() {
+    Uint64 counter = SDL_GetPerformanceCounter();
+    frameMs = static_cast<double>(counter - lastCounter) * 1000.0 / static_cast<double>(frequency);
+    lastCounter = counter;
+    realTimeMs += frameMs;
+    deltaMs = 0.0;
+
+    // Nothing is banked while paused, so resuming doesn't replay the pause
+    if (paused) {
+        pendingMs = 0.0;
+        return;
+    }
+
+    // Virtual time ignores the wall clock entirely
+    double elapsed = (fixedStepMs > 0.0) ? fixedStepMs : frameMs;
+    pendingMs += elapsed * timeScale;
+    if (pendingMs > SIMULATION_STEP * MAX_STEPS_PER_FRAME) {
+        pendingMs = SIMULATION_STEP * MAX_STEPS_PER_FRAME;
+    }
+}
+
+bool GameClock::step() {
+    if (paused || pendingMs < SIMULATION_STEP) {
+        deltaMs = 0.0;
+        return false;
+    }
+    pendingMs -= SIMULATION_STEP;
+    deltaMs = SIMULATION_STEP;
+    gameTimeMs += SIMULATION_STEP;
+    return true;
+}
+
+void GameClock::setTimeScale(double scale) {
+    timeScale = (scale < 0.0) ? 0.0 : scale;
+}
+
+void GameClock::setFixedStep(double stepMs) {
+    fixedStepMs = (stepMs < 0.0) ? 0.0 : stepMs;
+}
+
+void GameClock::advance(double ms) {
+    if (ms > 0.0) {
+        gameTimeMs += ms;
+    }
+}
+
+void GameClock::setTime(double ms) {
+    gameTimeMs = (ms < 0.0) ? 0.0 : ms;
+    deltaMs = 0.0;
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include <SDL.h>
+
+// Singleton frame clock shared by every subsystem.
+// The high-resolution counter is sampled once per frame so all objects in a frame
+// agree on "now". Gameplay advances in fixed SIMULATION_STEP steps: the wall-clock
+// time of each frame is banked and paid out one step at a time, so physics that
+// moves a fixed amount per update runs at the same speed at any frame rate.
+// Game time can be paused, scaled, or driven by a fixed virtual frame time
+// (replays, headless fast-forward) without touching gameplay timers.
+class GameClock {
+public:
+    static GameClock& getInstance();
+
+    // Length of one gameplay update in milliseconds (60 Hz)
+    static constexpr double SIMULATION_STEP = 1000.0 / 60.0;
+
+    // Sample the performance counter and bank the (scaled) time since the last frame.
+    // Call once per frame, then run one gameplay update per step() that returns true.
+    void beginFrame();
+    // Advance game time by one SIMULATION_STEP if that much is banked
+    bool step();
+
+    // Game time in milliseconds, frozen while paused
+    Uint32 now() const { return static_cast<Uint32>(gameTimeMs); }
+    double nowPrecise() const { return gameTimeMs; }
+
+    // Game time that elapsed during the last step (0 while paused)
+    Uint32 delta() const { return static_cast<Uint32>(deltaMs); }
+    double deltaPrecise() const { return deltaMs; }
+
+    // Unscaled wall-clock milliseconds since the clock was created
+    double realNow() const { return realTimeMs; }
+    // Unscaled wall-clock length of the last frame
+    double frameTime() const { return frameMs; }
+    // How far the banked time is into the next step, 0 to 1. Rendering blends each
+    // entity from its previous to its current step position by this much (1 while paused).
+    double stepFraction() const { return paused ? 1.0 : pendingMs / SIMULATION_STEP; }
+
+    // Pause control - while paused, now() does not move
+    void pause() { paused = true; }
+    void resume() { paused = false; }
+    void setPaused(bool value) { paused = value; }
+    bool isPaused() const { return paused; }
+
+    // Time scaling (1.0 = real time, 0.5 = slow motion, 2.0 = fast-forward)
+    void setTimeScale(double scale);
+    double getTimeScale() const { return timeScale; }
+
+    // Virtual time: when stepMs > 0 every frame banks exactly stepMs
+    // regardless of the wall clock. Pass 0 to go back to real time.
+    void setFixedStep(double stepMs);
+    double getFixedStep() const { return fixedStepMs; }
+
+    // Move game time directly (fast-forward or restore a saved time)
+    void advance(double ms);
+    void setTime(double ms);
+
+private:
+    GameClock();
+    GameClock(const GameClock&) = delete;
+    GameClock& operator=(const GameClock&) = delete;
+
+    Uint64 frequency;
+    Uint64 lastCounter;
+    double realTimeMs;
+    double gameTimeMs;
+    double deltaMs;
+    double frameMs;
+    double pendingMs;  // Banked game time not yet stepped
+    double timeScale;
+    double fixedStepMs;
+    bool paused;
+
+    // A frame that stalls longer than this many steps is slowed down instead of
+    // caught up, so one hitch can't trigger a burst of updates
+    static const int MAX_STEPS_PER_FRAME = 5;
+};
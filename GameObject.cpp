@@ -1,6 +1,9 @@
 #include "GameObject.h"
 #include "Game.hpp"
 #include "Physics.hpp"
+#include "GameClock.h"
+#include "RenderQueue.h"
+#include "Telemetry.h"
 #include <SDL.h>
 #include <iostream>
 #include <cmath>   // For std::fabs
@@ -18,13 +21,13 @@ GameObject::GameObject(int x, int y, int width, int height)
       facingRight(true),
       currentState(IDLE),
       isAttacking(false),
+      attackResolved(false),
       isParrying(false),
       isDashing(false),
       isInvincibleDuringDash(false),
       hasParriedDuringDash(false),
       inHitState(false),
       permanentlyDisabled(false),
-      isMoving(false),
       isFlashing(false),
       deathCountUpdated(false),
       attackStartTime(0),
@@ -34,193 +37,264 @@ GameObject::GameObject(int x, int y, int width, int height)
       dashStartTime(0),
       takeHitStartTime(0),
       takeHitDuration(300),
-      lastAttackTime(0),
-      lastParryTime(0),
-      lastDashTime(0),
+      // Cooldowns start out ready whatever the clock reads: now - last wraps to exactly the cooldown
+      lastAttackTime(GameClock::getInstance().now() - ATTACK_COOLDOWN),
+      lastParryTime(GameClock::getInstance().now() - PARRY_COOLDOWN),
+      lastDashTime(GameClock::getInstance().now() - BASE_DASH_COOLDOWN),
       flashStartTime(0),
       flashDuration(150),
       flashAlpha(255),
+      attackTimer(TimerWheel::INVALID_TIMER),
+      parryTimer(TimerWheel::INVALID_TIMER),
+      dashTimer(TimerWheel::INVALID_TIMER),
+      takeHitTimer(TimerWheel::INVALID_TIMER),
+      flashTimer(TimerWheel::INVALID_TIMER),
       currentFrame(0),
-      animationTransitionThreshold(0.01f),
-      lastFrameTime(SDL_GetTicks()),
-      animSpeed(100),
-      parryFrameIndex(0),
       enemiesDefeatedCount(0),
+      anim{IDLE, GameClock::getInstance().now()},
+      animationTransitionThreshold(0.01f),
       game(nullptr)  // Initialize game pointer
 {
-    // Load textures
-    idleTexture = TextureManager::loadTexture("assets/Idle.png");
-    runTexture = TextureManager::loadTexture("assets/Run.png");
-    attackTexture = TextureManager::loadTexture("assets/Attack.png");
-    takeHitTexture = TextureManager::loadTexture("assets/Take Hit.png");
-    deathTexture = TextureManager::loadTexture("assets/Death.png");
-    dashTexture = TextureManager::loadTexture("assets/Dash.png");
-
-    if (!idleTexture || !runTexture || !attackTexture || !takeHitTexture || !deathTexture || !dashTexture) {
-        std::cerr << "Failed to load textures" << std::endl;
-        return;
-    }
+    // Sprite sheets, from the shared atlas page when it holds them
+    AtlasRegion idleSheet = TextureAtlas::loadRegion(Game::spriteAtlas, "assets/Idle.png");
+    AtlasRegion runSheet = TextureAtlas::loadRegion(Game::spriteAtlas, "assets/Run.png");
+    AtlasRegion attackSheet = TextureAtlas::loadRegion(Game::spriteAtlas, "assets/Attack.png");
+    AtlasRegion takeHitSheet = TextureAtlas::loadRegion(Game::spriteAtlas, "assets/Take Hit.png");
+    AtlasRegion deathSheet = TextureAtlas::loadRegion(Game::spriteAtlas, "assets/Death.png");
+    AtlasRegion dashSheet = TextureAtlas::loadRegion(Game::spriteAtlas, "assets/Dash.png");
 
     // Initialize random seed
     std::srand(static_cast<unsigned int>(std::time(nullptr)));
 
-    // Start with idle animation
-    currentTexture = idleTexture;
-    totalFrames = 11; // Idle animation has 11 frames
+    // Build the clip table: texture, strip frames, ms per frame, playback
+    animations.defineStrip(IDLE, idleSheet, 11, 100, CLIP_LOOP);
+    animations.defineStrip(RUNNING, runSheet, 8, 100, CLIP_LOOP);
+    animations.defineAlias(JUMPING, RUNNING);
+    animations.defineStrip(ATTACKING, attackSheet, 6, 50, CLIP_ONCE);
+    animations.defineStrip(PARRYING, attackSheet, 6, 100, CLIP_ONCE, -1, PARRY_POSE_FRAME, 1);
+    animations.defineStrip(DASHING, dashSheet, DASH_FRAMES, DASH_DURATION / DASH_FRAMES, CLIP_ONCE);
+    animations.defineStrip(TAKE_HIT, takeHitSheet, 4, 100, CLIP_ONCE);
+    animations.defineStrip(DEATH, deathSheet, 9, 100, CLIP_ONCE);
+
+    if (!animations.hasClip(IDLE) || !animations.hasClip(RUNNING) || !animations.hasClip(ATTACKING) ||
+        !animations.hasClip(DASHING) || !animations.hasClip(TAKE_HIT) || !animations.hasClip(DEATH)) {
+        std::cerr << "Failed to load textures" << std::endl;
+        return;
+    }
 
-    // Get sprite dimensions from idle texture
-    int totalWidth, totalHeight;
-    SDL_QueryTexture(idleTexture, NULL, NULL, &totalWidth, &totalHeight);
-    frameHeight = totalHeight;
-    frameWidth = totalWidth / totalFrames;
+    // Sprite dimensions come from the idle frames
+    const SDL_Rect& firstFrame = animations.getClip(IDLE).frames[0];
 
     // Set up rectangles
-    srcRect = { 0, 0, frameWidth, frameHeight };
-    destRect = { x, y, static_cast<int>(frameWidth), static_cast<int>(frameHeight) };
+    srcRect = firstFrame;
+    destRect = { x, y, firstFrame.w, firstFrame.h };
 
     // Set up collider
-    collider = { x, y, static_cast<int>(frameWidth / 2), static_cast<int>(frameHeight / 2) };
+    collider = { x, y, firstFrame.w / 2, firstFrame.h / 2 };
     collider.x = x + (destRect.w - collider.w) / 2;
     collider.y = y + (destRect.h - collider.h) / 2;
 }
 
 GameObject::~GameObject() {
     // Textures are managed by TextureManager
+    // Pending timers capture this object, drop them before it goes away
+    TimerWheel& timers = TimerWheel::getInstance();
+    timers.cancel(attackTimer);
+    timers.cancel(parryTimer);
+    timers.cancel(dashTimer);
+    timers.cancel(takeHitTimer);
+    timers.cancel(flashTimer);
 }
 
-void GameObject::update() {
-    // Handle dash state
-    if (isDashing) {
-        Uint32 currentTime = SDL_GetTicks();
-        if (currentTime - dashStartTime >= DASH_DURATION) {
-            isDashing = false;
-            isFlashing = false; // End invulnerability
-            currentState = onGround ? IDLE : JUMPING;
-            currentTexture = onGround ? idleTexture : runTexture;
-        } else {
-            currentState = DASHING;
-            currentTexture = dashTexture;  // Use dash animation
-            animSpeed = 50;  // Make dash animation faster
-            
-            // Update dash animation frame
-            int frameElapsed = ((currentTime - dashStartTime) * DASH_FRAMES) / DASH_DURATION;
-            currentFrame = frameElapsed % DASH_FRAMES;
-            srcRect.x = currentFrame * frameWidth;
-        }
+void GameObject::endAttack() {
+    attackTimer = TimerWheel::INVALID_TIMER;
+    if (!isAttacking) return;
+    isAttacking = false;
+    if (!inHitState && !permanentlyDisabled) {
+        currentState = onGround ? IDLE : JUMPING;
     }
+}
 
-    // Update flash effect
-    if (isFlashing) {
-        Uint32 currentTime = SDL_GetTicks();
-        Uint32 flashElapsed = currentTime - flashStartTime;
-        if (flashElapsed >= flashDuration) {
-            isFlashing = false;
-        } else {
-            // Fade out the flash
-            flashAlpha = static_cast<Uint8>(255 * (1.0f - static_cast<float>(flashElapsed) / flashDuration));
-        }
+void GameObject::endParry() {
+    parryTimer = TimerWheel::INVALID_TIMER;
+    isParrying = false;
+    if (!inHitState && !permanentlyDisabled) {
+        currentState = onGround ? IDLE : JUMPING;
     }
+}
 
-    if (inHitState) {
-        if (SDL_GetTicks() - takeHitStartTime >= static_cast<Uint32>(takeHitDuration)) {
-            inHitState = false;
-            permanentlyDisabled = true;
-            currentState = DEATH;
-            velocityX = 0.0f;
-        }
-    }
+void GameObject::endDash() {
+    dashTimer = TimerWheel::INVALID_TIMER;
+    isDashing = false;
+    isFlashing = false; // End invulnerability
+    TimerWheel::getInstance().cancel(flashTimer);
+    currentState = onGround ? IDLE : JUMPING;
+}
 
-    if (isAttacking) {
-        if (SDL_GetTicks() - attackStartTime >= attackDuration) {
-            isAttacking = false;
-            if (!inHitState && !permanentlyDisabled) {
-                currentState = onGround ? IDLE : JUMPING;
-            }
-        }
-    }
+void GameObject::endTakeHit() {
+    takeHitTimer = TimerWheel::INVALID_TIMER;
+    inHitState = false;
+    permanentlyDisabled = true;
+    currentState = DEATH;
+    velocityX = 0.0f;
+}
 
-    if (isParrying) {
-        if (SDL_GetTicks() - parryStartTime >= parryDuration) {
-            isParrying = false;
-            if (!inHitState && !permanentlyDisabled) {
-                currentTexture = idleTexture;
-                currentFrame = 0;
-                currentState = onGround ? IDLE : JUMPING;
-            }
-        } else {
-            // Keep showing the selected parry frame
-            currentFrame = parryFrameIndex;
-        }
-    }
+void GameObject::startFlash(Uint32 currentTime) {
+    isFlashing = true;
+    flashStartTime = currentTime;
+    flashAlpha = 255;
 
-    if (!isAttacking && !isParrying && !inHitState && !permanentlyDisabled) {
-        if (!onGround && currentState != JUMPING) {
-            currentState = JUMPING;
-        } else if (onGround) {
-            bool isMoving = std::fabs(velocityX) > 0.5f;
-            currentState = isMoving ? RUNNING : IDLE;
-        }
-    }
+    TimerWheel& timers = TimerWheel::getInstance();
+    timers.cancel(flashTimer);
+    flashTimer = timers.schedule(flashDuration, [this]() { endFlash(); });
+}
 
-    // Update animation frame
-    Uint32 currentTime = SDL_GetTicks();
-    if (!isParrying && currentTime - lastFrameTime >= static_cast<Uint32>(animSpeed)) {
-        lastFrameTime = currentTime;
-
-        // Get total frames based on current texture
-        int currentMaxFrames;
-        if (currentTexture == idleTexture) currentMaxFrames = 11;
-        else if (currentTexture == runTexture) currentMaxFrames = 8;
-        else if (currentTexture == attackTexture) currentMaxFrames = 6;
-        else if (currentTexture == takeHitTexture) currentMaxFrames = 4;
-        else if (currentTexture == deathTexture) currentMaxFrames = 9;
-        else currentMaxFrames = totalFrames;
-
-        // Handle animations that should only play once (death)
-        if (permanentlyDisabled) {
-            if (currentFrame < currentMaxFrames - 1) {
-                currentFrame++;
-            }
-            // Stay on last frame
-        }
-        // Handle attack animation
-        else if (isAttacking) {
-            if (currentFrame < currentMaxFrames - 1) {
-                currentFrame++;
-            }
-            // Only reset attack state when animation completes
-            if (currentFrame >= currentMaxFrames - 1) {
-                isAttacking = false;
-                currentTexture = idleTexture;
-                currentFrame = 0;
-                currentState = onGround ? IDLE : JUMPING;
-                animSpeed = 100; // Reset animation speed
-                isMoving = false; // Reset moving state to allow new movement transitions
-            }
-        } else {
-            currentFrame = (currentFrame + 1) % currentMaxFrames;
-        }
+void GameObject::endFlash() {
+    flashTimer = TimerWheel::INVALID_TIMER;
+    isFlashing = false;
+}
 
-        srcRect.x = currentFrame * frameWidth;
-    }
+void GameObject::saveState(SnapshotFormat::PlayerState& state) const {
+    const TimerWheel& timers = TimerWheel::getInstance();
+    auto timeLeft = [&timers](TimerWheel::TimerId id) {
+        return timers.isPending(id) ? timers.remaining(id) : SnapshotFormat::NO_TIMER;
+    };
+
+    state = SnapshotFormat::PlayerState();
+    state.x = xpos;
+    state.y = ypos;
+    state.prevX = prevX;
+    state.prevY = prevY;
+    state.velocityX = velocityX;
+    state.velocityY = velocityY;
+    state.onGround = onGround;
+    state.facingRight = facingRight;
+    state.currentState = static_cast<std::uint8_t>(currentState);
+    state.isAttacking = isAttacking;
+    state.attackResolved = attackResolved;
+    state.isParrying = isParrying;
+    state.isDashing = isDashing;
+    state.isInvincibleDuringDash = isInvincibleDuringDash;
+    state.hasParriedDuringDash = hasParriedDuringDash;
+    state.inHitState = inHitState;
+    state.permanentlyDisabled = permanentlyDisabled;
+    state.isFlashing = isFlashing;
+    state.deathCountUpdated = deathCountUpdated;
+    state.flashAlpha = flashAlpha;
+    state.attackStartTime = attackStartTime;
+    state.attackDuration = attackDuration;
+    state.parryStartTime = parryStartTime;
+    state.parryDuration = parryDuration;
+    state.dashStartTime = dashStartTime;
+    state.takeHitStartTime = takeHitStartTime;
+    state.takeHitDuration = takeHitDuration;
+    state.lastAttackTime = lastAttackTime;
+    state.lastParryTime = lastParryTime;
+    state.lastDashTime = lastDashTime;
+    state.flashStartTime = flashStartTime;
+    state.flashDuration = flashDuration;
+    state.animClip = anim.clip;
+    state.animStartTime = anim.startTime;
+    state.currentFrame = currentFrame;
+    state.enemiesDefeated = enemiesDefeatedCount;
+
+    state.attackTimer = timeLeft(attackTimer);
+    state.parryTimer = timeLeft(parryTimer);
+    state.dashTimer = timeLeft(dashTimer);
+    state.takeHitTimer = timeLeft(takeHitTimer);
+    state.flashTimer = timeLeft(flashTimer);
+}
+
+bool GameObject::isValidState(const SnapshotFormat::PlayerState& state) {
+    // Animation states double as clip ids, so both must be a defined state
+    return state.currentState <= DEATH && state.animClip >= IDLE && state.animClip <= DEATH &&
+           std::isfinite(state.velocityX) && std::isfinite(state.velocityY);
+}
+
+bool GameObject::loadState(const SnapshotFormat::PlayerState& state) {
+    if (!isValidState(state)) return false;
+
+    prevX = state.prevX;
+    prevY = state.prevY;
+    setX(state.x);
+    setY(state.y);
+    velocityX = state.velocityX;
+    velocityY = state.velocityY;
+    onGround = state.onGround != 0;
+    facingRight = state.facingRight != 0;
+    currentState = static_cast<AnimationState>(state.currentState);
+    isAttacking = state.isAttacking != 0;
+    attackResolved = state.attackResolved != 0;
+    isParrying = state.isParrying != 0;
+    isDashing = state.isDashing != 0;
+    isInvincibleDuringDash = state.isInvincibleDuringDash != 0;
+    hasParriedDuringDash = state.hasParriedDuringDash != 0;
+    inHitState = state.inHitState != 0;
+    permanentlyDisabled = state.permanentlyDisabled != 0;
+    isFlashing = state.isFlashing != 0;
+    deathCountUpdated = state.deathCountUpdated != 0;
+    flashAlpha = state.flashAlpha;
+    attackStartTime = state.attackStartTime;
+    attackDuration = state.attackDuration;
+    parryStartTime = state.parryStartTime;
+    parryDuration = state.parryDuration;
+    dashStartTime = state.dashStartTime;
+    takeHitStartTime = state.takeHitStartTime;
+    takeHitDuration = state.takeHitDuration;
+    lastAttackTime = state.lastAttackTime;
+    lastParryTime = state.lastParryTime;
+    lastDashTime = state.lastDashTime;
+    flashStartTime = state.flashStartTime;
+    flashDuration = state.flashDuration;
+    anim.clip = state.animClip;
+    anim.startTime = state.animStartTime;
+    currentFrame = state.currentFrame;
+    enemiesDefeatedCount = state.enemiesDefeated;
+
+    // Timers come back with the time they had left
+    TimerWheel& timers = TimerWheel::getInstance();
+    timers.cancel(attackTimer);
+    timers.cancel(parryTimer);
+    timers.cancel(dashTimer);
+    timers.cancel(takeHitTimer);
+    timers.cancel(flashTimer);
+    if (state.attackTimer != SnapshotFormat::NO_TIMER) attackTimer = timers.schedule(state.attackTimer, [this]() { endAttack(); });
+    if (state.parryTimer != SnapshotFormat::NO_TIMER) parryTimer = timers.schedule(state.parryTimer, [this]() { endParry(); });
+    if (state.dashTimer != SnapshotFormat::NO_TIMER) dashTimer = timers.schedule(state.dashTimer, [this]() { endDash(); });
+    if (state.takeHitTimer != SnapshotFormat::NO_TIMER) takeHitTimer = timers.schedule(state.takeHitTimer, [this]() { endTakeHit(); });
+    if (state.flashTimer != SnapshotFormat::NO_TIMER) flashTimer = timers.schedule(state.flashTimer, [this]() { endFlash(); });
+    return true;
+}
 
-    // Handle movement animation transitions
-    if (!isAttacking && !isParrying) {  // Don't change animations during attack or parry
-        if (std::fabs(velocityX) > animationTransitionThreshold && !isMoving) {
-            isMoving = true;
-            currentTexture = runTexture;
-            currentFrame = 0;
-            currentState = RUNNING;
-            totalFrames = 8; // Set correct frame count for running animation
-        } else if (std::fabs(velocityX) <= animationTransitionThreshold && isMoving) {
-            isMoving = false;
-            currentTexture = idleTexture;
-            currentFrame = 0;
-            currentState = IDLE;
-            totalFrames = 11; // Set correct frame count for idle animation
+void GameObject::update() {
+    // Dash, attack, parry, take-hit and flash expirations are fired by the
+    // timer wheel; only the per-frame visuals are handled here
+    Uint32 currentTime = GameClock::getInstance().now();
+
+    // Fade out the flash
+    if (isFlashing) {
+        Uint32 flashElapsed = currentTime - flashStartTime;
+        if (flashElapsed < flashDuration) {
+            flashAlpha = static_cast<Uint8>(255 * (1.0f - static_cast<float>(flashElapsed) / flashDuration));
         }
     }
 
+    // Pick the state from the action flags, highest priority first
+    if (permanentlyDisabled) currentState = DEATH;
+    else if (inHitState) currentState = TAKE_HIT;
+    else if (isDashing) currentState = DASHING;
+    else if (isParrying) currentState = PARRYING;
+    else if (isAttacking) currentState = ATTACKING;
+    else if (!onGround) currentState = JUMPING;
+    else currentState = (std::fabs(velocityX) > animationTransitionThreshold) ? RUNNING : IDLE;
+
+    // The state is the clip id; switching clips restarts from frame 0
+    AnimationTable::play(anim, currentState, currentTime);
+    currentFrame = animations.advance(anim, currentTime);
+    if (animations.hasClip(anim.clip)) {
+        srcRect = animations.getClip(anim.clip).frames[currentFrame];
+    }
+
     // Update rectangles
     destRect.x = xpos;
     destRect.y = ypos;
@@ -233,33 +307,12 @@ void GameObject::update() {
 }
 
 void GameObject::renderSprite(int x, int y) {
-    if (!Game::renderer || !currentTexture) return;
+    if (!Game::renderer || !animations.hasClip(anim.clip)) return;
 
     SDL_Rect tempDestRect = { x, y, destRect.w, destRect.h };
     SDL_RendererFlip flip = facingRight ? SDL_FLIP_NONE : SDL_FLIP_HORIZONTAL;
-
-    // Update texture based on state
-    if (permanentlyDisabled) {
-        currentTexture = deathTexture;
-    } else if (inHitState) {
-        currentTexture = takeHitTexture;
-    }
-
-    // Handle flash effect
-    if (isFlashing) {
-        SDL_SetTextureBlendMode(currentTexture, SDL_BLENDMODE_ADD);
-        SDL_SetTextureColorMod(currentTexture, 255, 255, 255);
-        SDL_SetTextureAlphaMod(currentTexture, flashAlpha);
-    }
-
-    SDL_RenderCopyEx(Game::renderer, currentTexture, &srcRect, &tempDestRect, 0, NULL, flip);
-
-    // Reset texture properties after rendering
-    if (isFlashing) {
-        SDL_SetTextureBlendMode(currentTexture, SDL_BLENDMODE_BLEND);
-        SDL_SetTextureColorMod(currentTexture, 255, 255, 255);
-        SDL_SetTextureAlphaMod(currentTexture, 255);
-    }
+    AnimationTable::submitFrame(LAYER_ENTITIES, animations.getClip(anim.clip), srcRect, tempDestRect, flip,
+                                isFlashing, flashAlpha);
 }
 
 void GameObject::renderHitboxes(int x, int y) {
@@ -315,6 +368,14 @@ void GameObject::render(int x, int y) {
     renderHitboxes(x, y);
 }
 
+int GameObject::getRenderX(double fraction) const {
+    return prevX + static_cast<int>(std::lround((xpos - prevX) * fraction));
+}
+
+int GameObject::getRenderY(double fraction) const {
+    return prevY + static_cast<int>(std::lround((ypos - prevY) * fraction));
+}
+
 SDL_Rect GameObject::getAttackHitbox() const {
     if (!isAttacking) {
         return {0, 0, 0, 0};
@@ -347,17 +408,21 @@ void GameObject::move(int dx) {
 
 void GameObject::takeHit() {
     if (!inHitState && !permanentlyDisabled) {
+        Uint32 currentTime = GameClock::getInstance().now();
         inHitState = true;
-        takeHitStartTime = SDL_GetTicks();
+        takeHitStartTime = currentTime;
         takeHitDuration = 300;
+        Telemetry::getInstance().record(TelemetryFormat::EVENT_DAMAGE_TAKEN, 0, xpos, ypos);
         currentState = TAKE_HIT;
-        currentTexture = takeHitTexture;
+        AnimationTable::play(anim, TAKE_HIT, currentTime);
         currentFrame = 0;
 
+        TimerWheel& timers = TimerWheel::getInstance();
+        timers.cancel(takeHitTimer);
+        takeHitTimer = timers.schedule(takeHitDuration, [this]() { endTakeHit(); });
+
         // Start flash effect
-        isFlashing = true;
-        flashStartTime = SDL_GetTicks();
-        flashAlpha = 255;
+        startFlash(currentTime);
 
         // Trigger fade effect using game reference
         if (game) {
@@ -375,7 +440,7 @@ void GameObject::takeHit() {
 }
 
 void GameObject::parry() {
-    Uint32 currentTime = SDL_GetTicks();
+    Uint32 currentTime = GameClock::getInstance().now();
     if (currentTime - lastParryTime < PARRY_COOLDOWN) {
         return; // Still in cooldown
     }
@@ -385,20 +450,21 @@ void GameObject::parry() {
         parryStartTime = currentTime;
         lastParryTime = currentTime;
         parryDuration = 200; // Shorter parry window for more precise timing
-        currentTexture = attackTexture;
         currentState = PARRYING;
-
-        // Use a specific frame for parry animation
-        currentFrame = 2; // Using frame 2 of attack animation for parry pose
-        srcRect.x = currentFrame * frameWidth;
+        AnimationTable::play(anim, PARRYING, currentTime);
+        currentFrame = 0;
 
         // Reset any existing velocity when parrying
         velocityX = 0.0f;
+
+        TimerWheel& timers = TimerWheel::getInstance();
+        timers.cancel(parryTimer);
+        parryTimer = timers.schedule(parryDuration, [this]() { endParry(); });
     }
 }
 
 void GameObject::attack() {
-    Uint32 currentTime = SDL_GetTicks();
+    Uint32 currentTime = GameClock::getInstance().now();
     if (currentTime - lastAttackTime < ATTACK_COOLDOWN) {
         return; // Still in cooldown
     }
@@ -406,11 +472,16 @@ void GameObject::attack() {
     // Allow new attack if not already attacking, not parrying, not in hit state and not disabled
     if (!isParrying && !inHitState && !permanentlyDisabled) {
         isAttacking = true;
+        attackResolved = false;
         attackStartTime = currentTime;
         lastAttackTime = currentTime;
-        currentTexture = attackTexture;
+        currentState = ATTACKING;
+        AnimationTable::play(anim, ATTACKING, currentTime, true);
         currentFrame = 0;
-        animSpeed = 50;  // Make attack animation slightly faster
+
+        TimerWheel& timers = TimerWheel::getInstance();
+        timers.cancel(attackTimer);
+        attackTimer = timers.schedule(attackDuration, [this]() { endAttack(); });
     }
 }
 
@@ -435,7 +506,7 @@ void GameObject::dash() {
         return;
     }
 
-    Uint32 currentTime = SDL_GetTicks();
+    Uint32 currentTime = GameClock::getInstance().now();
     
     // Calculate current dash cooldown based on enemies defeated
     Uint32 currentCooldown = BASE_DASH_COOLDOWN;
@@ -459,6 +530,7 @@ void GameObject::dash() {
         isDashing = true;
         dashStartTime = currentTime;
         lastDashTime = currentTime; // Set cooldown start time when dash begins
+        Telemetry::getInstance().record(TelemetryFormat::EVENT_DASH, 0, xpos, ypos);
         hasParriedDuringDash = false;
         
         // Play random dash sound
@@ -468,8 +540,10 @@ void GameObject::dash() {
         setX(xpos + (facingRight ? 75 : -75));
         
         // Make player invulnerable during dash with flash effect
-        isFlashing = true;
-        flashStartTime = currentTime;
-        flashAlpha = 255;
+        startFlash(currentTime);
+
+        TimerWheel& timers = TimerWheel::getInstance();
+        timers.cancel(dashTimer);
+        dashTimer = timers.schedule(DASH_DURATION, [this]() { endDash(); });
     }
 }
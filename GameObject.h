@@ -1,6 +1,9 @@
 #pragma once
 #include <SDL.h>
 #include "Game.hpp"
+#include "TimerWheel.h"
+#include "Animation.h"
+#include "SnapshotFormat.h"
 
 class Physics;
 
@@ -42,19 +45,30 @@ public:
     void setX(int x) { xpos = x; destRect.x = x; collider.x = x + (destRect.w - collider.w) / 2; }
     void setY(int y) { ypos = y; destRect.y = y; collider.y = y + (destRect.h - collider.h) / 2; }
     AnimationState getState() const { return currentState; }
+    // Position to draw at, blended from the previous step's by GameClock::stepFraction()
+    int getRenderX(double fraction) const;
+    int getRenderY(double fraction) const;
     void revertPosition();
     SDL_Rect getCollider() const { return collider; }
     SDL_Rect getAttackHitbox() const;
     void setGameRef(Game* gameRef) { game = gameRef; }
     int getCurrentFrame() const { return currentFrame; }
     bool isDeathAnimationComplete() const {
-        return currentTexture == deathTexture && currentFrame >= 8;
+        return anim.clip == DEATH && animations.hasClip(DEATH) &&
+               currentFrame >= animations.getClip(DEATH).frameCount() - 1;
     }
     void incrementEnemiesDefeated() { 
         enemiesDefeatedCount++; 
     }
     int getEnemiesDefeated() const { return enemiesDefeatedCount; }
 
+    // Copy the physics, animation and timer state to or from a game-state snapshot.
+    // loadState expects the game clock to be restored already.
+    void saveState(SnapshotFormat::PlayerState& state) const;
+    // False (and nothing changed) if the state holds values the game can't use
+    bool loadState(const SnapshotFormat::PlayerState& state);
+    static bool isValidState(const SnapshotFormat::PlayerState& state);
+
     // Physics properties
     int prevX, prevY;
     float velocityX;
@@ -66,13 +80,13 @@ public:
     // Animation and state flags
     AnimationState currentState;
     bool isAttacking;
+    bool attackResolved;  // Combat has already judged this swing as a hit or a miss
     bool isParrying;
     bool isDashing;
     bool isInvincibleDuringDash;
     bool hasParriedDuringDash;
     bool inHitState;
     bool permanentlyDisabled;
-    bool isMoving;
     bool isFlashing;
     bool deathCountUpdated = false;
     
@@ -91,6 +105,13 @@ public:
     Uint32 flashDuration;
     Uint8 flashAlpha;
 
+    // Pending expirations in the shared timer wheel
+    TimerWheel::TimerId attackTimer;
+    TimerWheel::TimerId parryTimer;
+    TimerWheel::TimerId dashTimer;
+    TimerWheel::TimerId takeHitTimer;
+    TimerWheel::TimerId flashTimer;
+
     SDL_Rect destRect;
 
     // Game constants
@@ -103,29 +124,27 @@ public:
     static const Uint32 COOLDOWN_REDUCTION_PER_ENEMY = 500;
 
 private:
+    // Timer callbacks fired when a timed state runs out
+    void endAttack();
+    void endParry();
+    void endDash();
+    void endTakeHit();
+    void endFlash();
+    void startFlash(Uint32 currentTime);
+
     SDL_Rect srcRect;
     SDL_Rect collider;
     int currentFrame;
     int enemiesDefeatedCount;
 
-    // Sprite and animation properties
-    SDL_Texture* idleTexture;
-    SDL_Texture* runTexture;
-    SDL_Texture* attackTexture;
-    SDL_Texture* dashTexture;
-    SDL_Texture* takeHitTexture;
-    SDL_Texture* deathTexture;
-    SDL_Texture* currentTexture;
-    int totalFrames;
-    int frameWidth;
-    int frameHeight;
+    // Animation clips (indexed by AnimationState) and the playing clip
+    AnimationTable animations;
+    AnimationCursor anim;
     static const int DASH_FRAMES = 4;
+    static const int PARRY_POSE_FRAME = 2;  // Frame of the attack strip used as parry pose
 
-    // Animation control
+    // Velocity above which the run clip is shown
     float animationTransitionThreshold;
-    Uint32 lastFrameTime;
-    int animSpeed;
-    int parryFrameIndex;
 
     Game* game;
 
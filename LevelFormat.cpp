@@ -0,0 +1,217 @@
+#include "LevelFormat.h"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <iostream>
+
+namespace LevelFormat {
+    // Cell id meaning "nothing here"; the ground under a decor cell is stored as this
+    const int EMPTY_TILE = 3;
+
+    // Read the next whitespace-separated integer from [cursor, end); false at the end or on bad input
+    static bool readInt(const char*& cursor, const char* end, int& value) {
+        while (cursor < end && (*cursor == ' ' || *cursor == '\n' || *cursor == '\r' || *cursor == '\t')) {
+            cursor++;
+        }
+        if (cursor == end) return false;
+
+        std::from_chars_result result = std::from_chars(cursor, end, value);
+        if (result.ec != std::errc()) return false;
+        cursor = result.ptr;
+        return true;
+    }
+
+    static bool validSize(int rows, int cols) {
+        return rows > 0 && cols > 0 && rows <= MAX_TILES_PER_SIDE && cols <= MAX_TILES_PER_SIDE;
+    }
+
+    static int readTile(const unsigned char* p, int tileBytes) {
+        return tileBytes == 1 ? p[0] : p[0] | (p[1] << 8);
+    }
+
+    static void writeTile(std::vector<char>& out, int tile, int tileBytes) {
+        out.push_back(static_cast<char>(tile & 0xFF));
+        if (tileBytes == 2) out.push_back(static_cast<char>((tile >> 8) & 0xFF));
+    }
+
+    // Decode one layer into tiles. The decor layer only overwrites cells where it is non-zero.
+    static bool decodeLayer(const unsigned char* p, size_t bytes, int tileBytes, int encoding,
+                            std::vector<int>& tiles, bool decor) {
+        const unsigned char* end = p + bytes;
+        size_t count = tiles.size();
+
+        if (encoding == LAYER_RAW) {
+            if (bytes != count * tileBytes) return false;
+            for (size_t i = 0; i < count; i++, p += tileBytes) {
+                int tile = readTile(p, tileBytes);
+                if (!decor || tile != 0) tiles[i] = tile;
+            }
+            return true;
+        }
+
+        size_t filled = 0;
+        while (p < end) {
+            if (end - p < 2 + tileBytes) return false;
+            size_t run = p[0] | (p[1] << 8);
+            int tile = readTile(p + 2, tileBytes);
+            p += 2 + tileBytes;
+            if (run == 0 || filled + run > count) return false;
+
+            if (!decor || tile != 0) {
+                for (size_t i = 0; i < run; i++) tiles[filled + i] = tile;
+            }
+            filled += run;
+        }
+        return filled == count;
+    }
+
+    static void encodeLayer(const std::vector<int>& layer, int tileBytes, int encoding, std::vector<char>& out) {
+        if (encoding == LAYER_RAW) {
+            for (int tile : layer) writeTile(out, tile, tileBytes);
+            return;
+        }
+
+        size_t i = 0;
+        while (i < layer.size()) {
+            size_t run = 1;
+            while (i + run < layer.size() && run < 0xFFFF && layer[i + run] == layer[i]) run++;
+            out.push_back(static_cast<char>(run & 0xFF));
+            out.push_back(static_cast<char>(run >> 8));
+            writeTile(out, layer[i], tileBytes);
+            i += run;
+        }
+    }
+
+    bool isBinary(const char* data, size_t size) {
+        return size >= sizeof(MAGIC) && std::memcmp(data, MAGIC, sizeof(MAGIC)) == 0;
+    }
+
+    bool parseText(const char* data, size_t size, int& rows, int& cols, std::vector<int>& tiles) {
+        const char* cursor = data;
+        const char* end = data + size;
+
+        if (!readInt(cursor, end, rows) || !readInt(cursor, end, cols) || !validSize(rows, cols)) {
+            std::cout << "Invalid level header" << std::endl;
+            return false;
+        }
+
+        tiles.resize(static_cast<size_t>(rows) * cols);
+        for (int& tile : tiles) {
+            if (!readInt(cursor, end, tile)) {
+                std::cout << "Level has fewer than " << rows << "x" << cols << " tiles" << std::endl;
+                return false;
+            }
+        }
+        int extra;
+        if (readInt(cursor, end, extra)) {
+            std::cout << "Level has more tiles than its " << rows << "x" << cols << " header" << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    bool decodeBinary(const char* data, size_t size, int& rows, int& cols, std::vector<int>& tiles) {
+        // The header is read in place; every supported target is little-endian
+        LevelHeader header;
+        if (size < sizeof(header) || !isBinary(data, size)) {
+            std::cout << "Not a binary level" << std::endl;
+            return false;
+        }
+        std::memcpy(&header, data, sizeof(header));
+
+        if (header.version != VERSION) {
+            std::cout << "Unsupported binary level version " << header.version << std::endl;
+            return false;
+        }
+        if (!validSize(static_cast<int>(header.rows), static_cast<int>(header.cols)) ||
+            (header.tileBytes != 1 && header.tileBytes != 2) ||
+            (header.encoding != LAYER_RAW && header.encoding != LAYER_RUNS)) {
+            std::cout << "Invalid binary level header" << std::endl;
+            return false;
+        }
+
+        size_t decorBytes = (header.flags & LEVEL_HAS_DECOR) ? header.decorBytes : 0;
+        if (sizeof(header) + static_cast<size_t>(header.groundBytes) + decorBytes != size) {
+            std::cout << "Binary level size doesn't match its header" << std::endl;
+            return false;
+        }
+
+        rows = static_cast<int>(header.rows);
+        cols = static_cast<int>(header.cols);
+        tiles.assign(static_cast<size_t>(rows) * cols, EMPTY_TILE);
+
+        const unsigned char* ground = reinterpret_cast<const unsigned char*>(data) + sizeof(header);
+        if (!decodeLayer(ground, header.groundBytes, header.tileBytes, header.encoding, tiles, false) ||
+            (decorBytes > 0 &&
+             !decodeLayer(ground + header.groundBytes, decorBytes, header.tileBytes, header.encoding, tiles, true))) {
+            std::cout << "Corrupt binary level data" << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    bool encodeBinary(int rows, int cols, const std::vector<int>& tiles, bool forceRaw, std::vector<char>& out) {
+        if (!validSize(rows, cols) || tiles.size() != static_cast<size_t>(rows) * cols) {
+            std::cout << "Invalid level size" << std::endl;
+            return false;
+        }
+
+        // Split decor out of the ground layer
+        int maxTile = 0;
+        bool hasDecor = false;
+        std::vector<int> ground(tiles.size());
+        std::vector<int> decor(tiles.size(), 0);
+        for (size_t i = 0; i < tiles.size(); i++) {
+            if (tiles[i] < 0 || tiles[i] > 0xFFFF) {
+                std::cout << "Tile id " << tiles[i] << " doesn't fit the binary format" << std::endl;
+                return false;
+            }
+            maxTile = std::max(maxTile, tiles[i]);
+            if (tiles[i] >= FIRST_DECOR_TILE) {
+                ground[i] = EMPTY_TILE;
+                decor[i] = tiles[i];
+                hasDecor = true;
+            } else {
+                ground[i] = tiles[i];
+            }
+        }
+        int tileBytes = maxTile <= 0xFF ? 1 : 2;
+
+        // Runs pay off for typical maps (long empty and solid stretches), but check
+        std::vector<char> groundData, decorData;
+        int encoding = LAYER_RAW;
+        if (!forceRaw) {
+            encodeLayer(ground, tileBytes, LAYER_RUNS, groundData);
+            if (hasDecor) encodeLayer(decor, tileBytes, LAYER_RUNS, decorData);
+            size_t rawSize = tiles.size() * tileBytes * (hasDecor ? 2 : 1);
+            if (groundData.size() + decorData.size() < rawSize) {
+                encoding = LAYER_RUNS;
+            } else {
+                groundData.clear();
+                decorData.clear();
+            }
+        }
+        if (encoding == LAYER_RAW) {
+            encodeLayer(ground, tileBytes, LAYER_RAW, groundData);
+            if (hasDecor) encodeLayer(decor, tileBytes, LAYER_RAW, decorData);
+        }
+
+        LevelHeader header;
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = VERSION;
+        header.flags = hasDecor ? LEVEL_HAS_DECOR : 0;
+        header.rows = static_cast<std::uint32_t>(rows);
+        header.cols = static_cast<std::uint32_t>(cols);
+        header.tileBytes = static_cast<std::uint8_t>(tileBytes);
+        header.encoding = static_cast<std::uint8_t>(encoding);
+        header.reserved = 0;
+        header.groundBytes = static_cast<std::uint32_t>(groundData.size());
+        header.decorBytes = static_cast<std::uint32_t>(decorData.size());
+
+        const char* headerBytes = reinterpret_cast<const char*>(&header);
+        out.assign(headerBytes, headerBytes + sizeof(header));
+        out.insert(out.end(), groundData.begin(), groundData.end());
+        out.insert(out.end(), decorData.begin(), decorData.end());
+        return true;
+    }
+}
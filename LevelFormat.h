@@ -0,0 +1,60 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Level file formats shared by TileMap and the mapconv tool.
+//
+// Text (.map): "rows cols" followed by rows * cols whitespace-separated tile ids.
+//
+// Binary (.lvl), little-endian:
+//   LevelHeader
+//   ground layer  (groundBytes bytes)
+//   decor layer   (decorBytes bytes, only with LEVEL_HAS_DECOR)
+// The ground layer holds ids below FIRST_DECOR_TILE, the decor layer holds
+// decor ids or 0 for "no decor"; a decor id replaces the ground id of its cell.
+// A layer is either raw tiles (tileBytes each) or runs: a uint16 run length
+// followed by one tile id, repeated until the layer is full.
+namespace LevelFormat {
+    const char MAGIC[4] = { 'K', 'F', 'L', 'V' };
+    const std::uint16_t VERSION = 1;
+    const int FIRST_DECOR_TILE = 4;
+    const int MAX_TILES_PER_SIDE = 4096;
+
+    enum LevelFlags {
+        LEVEL_HAS_DECOR = 1 << 0
+    };
+
+    enum LayerEncoding {
+        LAYER_RAW = 0,
+        LAYER_RUNS = 1
+    };
+
+#pragma pack(push, 1)
+    struct LevelHeader {
+        char magic[4];
+        std::uint16_t version;
+        std::uint16_t flags;        // LevelFlags
+        std::uint32_t rows;
+        std::uint32_t cols;
+        std::uint8_t tileBytes;     // 1 (uint8 ids) or 2 (uint16 ids)
+        std::uint8_t encoding;      // LayerEncoding, same for both layers
+        std::uint16_t reserved;
+        std::uint32_t groundBytes;
+        std::uint32_t decorBytes;
+    };
+#pragma pack(pop)
+    static_assert(sizeof(LevelHeader) == 28, "LevelHeader must match the file layout");
+
+    // True if data starts with the binary level magic
+    bool isBinary(const char* data, size_t size);
+
+    // Parse a text level; tiles is row-major. Logs and returns false on malformed input.
+    bool parseText(const char* data, size_t size, int& rows, int& cols, std::vector<int>& tiles);
+
+    // Decode a binary level straight from data (e.g. a file mapping)
+    bool decodeBinary(const char* data, size_t size, int& rows, int& cols, std::vector<int>& tiles);
+
+    // Encode a level; runs are used when they come out smaller than raw tiles unless forceRaw is set
+    bool encodeBinary(int rows, int cols, const std::vector<int>& tiles, bool forceRaw, std::vector<char>& out);
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include <cstddef>
+
+// Read-only memory mapping of a whole file. The contents stay valid until
+// close() or destruction; nothing is copied into the process heap.
+class MappedFile {
+public:
+    MappedFile();
+    ~MappedFile();
+
+    // Map path; returns false (and logs) if it can't be opened or mapped
+    bool open(const char* path);
+    void close();
+
+    bool isOpen() const { return data != nullptr; }
+    const char* getData() const { return data; }
+    size_t getSize() const { return size; }
+
+private:
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* data;
+    size_t size;
+#ifdef _WIN32
+    void* fileHandle;
+    void* mappingHandle;
+#else
+    int fileDescriptor;
+#endif
+};
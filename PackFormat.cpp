@@ -0,0 +1,129 @@
+#include "PackFormat.h"
+#include <cstring>
+
+namespace PackFormat {
+    // LZ4 block format constants
+    const size_t MIN_MATCH = 4;
+    const size_t LAST_LITERALS = 5;   // The last bytes of a block are always literals
+    const size_t MATCH_START_LIMIT = 12;  // No match may start closer than this to the end
+    const size_t MAX_OFFSET = 65535;
+    const int HASH_BITS = 16;
+
+    static std::uint32_t read32(const unsigned char* p) {
+        std::uint32_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    static std::uint32_t hash4(std::uint32_t value) {
+        return (value * 2654435761u) >> (32 - HASH_BITS);
+    }
+
+    // Lengths of 15 and more spill into extra bytes of 255 each plus a remainder
+    static void writeLength(std::vector<char>& out, size_t length) {
+        while (length >= 255) {
+            out.push_back(static_cast<char>(255));
+            length -= 255;
+        }
+        out.push_back(static_cast<char>(length));
+    }
+
+    static bool readLength(const unsigned char*& ip, const unsigned char* end, size_t& length) {
+        unsigned char byte;
+        do {
+            if (ip >= end) return false;
+            byte = *ip++;
+            length += byte;
+        } while (byte == 255);
+        return true;
+    }
+
+    static void writeLiterals(std::vector<char>& out, const unsigned char* literals, size_t count, unsigned char matchToken) {
+        out.push_back(static_cast<char>(((count >= 15 ? 15 : count) << 4) | matchToken));
+        if (count >= 15) writeLength(out, count - 15);
+        out.insert(out.end(), literals, literals + count);
+    }
+
+    bool compressLz4(const char* data, size_t size, std::vector<char>& out) {
+        const unsigned char* src = reinterpret_cast<const unsigned char*>(data);
+        out.clear();
+        out.reserve(size);
+
+        // Last position each 4-byte sequence was seen at, plus one (0 = never)
+        std::vector<std::uint32_t> table(size_t(1) << HASH_BITS, 0);
+        size_t anchor = 0;
+        size_t pos = 0;
+
+        if (size > MATCH_START_LIMIT) {
+            size_t searchEnd = size - MATCH_START_LIMIT;
+            size_t matchEnd = size - LAST_LITERALS;
+
+            while (pos < searchEnd) {
+                std::uint32_t sequence = read32(src + pos);
+                std::uint32_t hash = hash4(sequence);
+                size_t candidate = table[hash];
+                table[hash] = static_cast<std::uint32_t>(pos + 1);
+
+                if (candidate == 0 || pos - (candidate - 1) > MAX_OFFSET || read32(src + candidate - 1) != sequence) {
+                    pos++;
+                    continue;
+                }
+
+                size_t ref = candidate - 1;
+                size_t length = MIN_MATCH;
+                while (pos + length < matchEnd && src[ref + length] == src[pos + length]) length++;
+
+                size_t extra = length - MIN_MATCH;
+                writeLiterals(out, src + anchor, pos - anchor, static_cast<unsigned char>(extra >= 15 ? 15 : extra));
+                size_t offset = pos - ref;
+                out.push_back(static_cast<char>(offset & 0xFF));
+                out.push_back(static_cast<char>(offset >> 8));
+                if (extra >= 15) writeLength(out, extra - 15);
+
+                pos += length;
+                anchor = pos;
+            }
+        }
+
+        // Final sequence: literals only
+        writeLiterals(out, src + anchor, size - anchor, 0);
+        return out.size() < size;
+    }
+
+    bool decompressLz4(const char* data, size_t size, char* out, size_t outSize) {
+        const unsigned char* ip = reinterpret_cast<const unsigned char*>(data);
+        const unsigned char* end = ip + size;
+        char* op = out;
+        char* outEnd = out + outSize;
+
+        while (ip < end) {
+            unsigned char token = *ip++;
+
+            size_t literals = token >> 4;
+            if (literals == 15 && !readLength(ip, end, literals)) return false;
+            if (literals > static_cast<size_t>(end - ip) || literals > static_cast<size_t>(outEnd - op)) return false;
+            std::memcpy(op, ip, literals);
+            op += literals;
+            ip += literals;
+
+            // The last sequence has no match part
+            if (ip == end) break;
+
+            if (end - ip < 2) return false;
+            size_t offset = ip[0] | (ip[1] << 8);
+            ip += 2;
+            if (offset == 0 || offset > static_cast<size_t>(op - out)) return false;
+
+            size_t length = token & 15;
+            if (length == 15 && !readLength(ip, end, length)) return false;
+            length += MIN_MATCH;
+            if (length > static_cast<size_t>(outEnd - op)) return false;
+
+            // Byte by byte: the match may overlap the bytes being written
+            const char* match = op - offset;
+            for (size_t i = 0; i < length; i++) op[i] = match[i];
+            op += length;
+        }
+        return op == outEnd;
+    }
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Asset pack (.pak) layout shared by AssetPack and the assetpack tool.
+// Little-endian:
+//   PackHeader
+//   PackEntry[entryCount]
+//   name table (entry names, not null-terminated, e.g. "assets/Idle.png")
+//   entry data, each entry starting on a DATA_ALIGNMENT boundary
+// Entries are stored as-is or LZ4 block compressed.
+namespace PackFormat {
+    const char MAGIC[4] = { 'K', 'F', 'P', 'K' };
+    const std::uint32_t VERSION = 1;
+    const std::uint32_t DATA_ALIGNMENT = 16;
+
+    enum Compression {
+        COMPRESSION_NONE = 0,
+        COMPRESSION_LZ4 = 1
+    };
+
+#pragma pack(push, 1)
+    struct PackHeader {
+        char magic[4];
+        std::uint32_t version;
+        std::uint32_t entryCount;
+        std::uint32_t nameTableSize;
+    };
+
+    struct PackEntry {
+        std::uint64_t offset;       // From the start of the file
+        std::uint64_t storedSize;   // Bytes in the file
+        std::uint64_t size;         // Bytes once decompressed
+        std::uint32_t compression;  // Compression
+        std::uint32_t nameOffset;   // Into the name table
+        std::uint32_t nameLength;
+        std::uint32_t reserved;
+    };
+#pragma pack(pop)
+    static_assert(sizeof(PackHeader) == 16, "PackHeader must match the file layout");
+    static_assert(sizeof(PackEntry) == 40, "PackEntry must match the file layout");
+
+    // LZ4 block compression (no frame header). Returns false if the data doesn't shrink.
+    bool compressLz4(const char* data, size_t size, std::vector<char>& out);
+
+    // Decompress an LZ4 block into exactly outSize bytes; false on corrupt input
+    bool decompressLz4(const char* data, size_t size, char* out, size_t outSize);
+}
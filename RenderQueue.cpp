@@ -0,0 +1,109 @@
+#include "RenderQueue.h"
+#include "SpriteBatch.h"
+#include "Game.hpp"
+#include <algorithm>
+
+RenderQueue& RenderQueue::getInstance() {
+    static RenderQueue instance;
+    return instance;
+}
+
+RenderQueue::RenderQueue() : sequence(0), stateChanges(0) {
+    commands.reserve(256);
+}
+
+Uint64 RenderQueue::makeKey(RenderLayer layer, SDL_Texture* texture, SDL_BlendMode blendMode, int depth) {
+    Uint64 depthRank = static_cast<Uint64>(std::max(0, std::min(depth + 0x800000, 0xFFFFFF)));
+    Uint32 order = sequence++;
+
+    // layer:8 | depth:24 | sequence:32 - overlapping sprites (and their additive
+    // flash quads) must draw exactly in the order they were submitted
+    if (keepsSubmissionOrder(layer)) {
+        return (static_cast<Uint64>(layer) << 56) | (depthRank << 32) | order;
+    }
+
+    // Textures rank by first submission this frame; fills (no texture) rank 0
+    Uint32 textureRank = 0;
+    if (texture) {
+        auto it = textureOrder.find(texture);
+        if (it == textureOrder.end()) {
+            textureRank = static_cast<Uint32>(textureOrder.size()) + 1;
+            textureOrder[texture] = textureRank;
+        } else {
+            textureRank = it->second;
+        }
+    }
+
+    // layer:8 | texture:24 | blend:8 | depth:24 (offset so negative depths sort first)
+    Uint64 blendRank = static_cast<Uint64>(blendMode) & 0xFF;
+    return (static_cast<Uint64>(layer) << 56) |
+           (static_cast<Uint64>(textureRank & 0xFFFFFF) << 32) |
+           (blendRank << 24) |
+           depthRank;
+}
+
+void RenderQueue::submit(RenderLayer layer, SDL_Texture* texture, const SDL_Rect* srcRect, const SDL_Rect& destRect,
+                         SDL_RendererFlip flip, SDL_Color color, SDL_BlendMode blendMode, int depth) {
+    if (!texture) return;
+
+    SDL_Rect source = { 0, 0, 0, 0 };
+    if (srcRect) {
+        source = *srcRect;
+    } else {
+        SDL_QueryTexture(texture, NULL, NULL, &source.w, &source.h);
+    }
+
+    commands.push_back(Command{ makeKey(layer, texture, blendMode, depth), texture, source, destRect,
+                                flip, color, blendMode });
+}
+
+void RenderQueue::submitTransient(RenderLayer layer, SDL_Texture* texture, const SDL_Rect& destRect, SDL_Color color) {
+    if (!texture) return;
+    transientTextures.push_back(texture);
+    submit(layer, texture, nullptr, destRect, SDL_FLIP_NONE, color);
+}
+
+void RenderQueue::submitFill(RenderLayer layer, const SDL_Rect& rect, SDL_Color color, SDL_BlendMode blendMode) {
+    commands.push_back(Command{ makeKey(layer, nullptr, blendMode, 0), nullptr, { 0, 0, 0, 0 }, rect,
+                                SDL_FLIP_NONE, color, blendMode });
+}
+
+void RenderQueue::execute() {
+    // Stable, so equal keys keep submission order
+    std::stable_sort(commands.begin(), commands.end(), [](const Command& a, const Command& b) {
+        return a.key < b.key;
+    });
+
+    SpriteBatch& batch = SpriteBatch::getInstance();
+    SDL_Texture* boundTexture = nullptr;
+    SDL_BlendMode boundBlend = SDL_BLENDMODE_INVALID;
+    stateChanges = 0;
+
+    for (const Command& command : commands) {
+        if (command.texture != boundTexture || command.blendMode != boundBlend) {
+            boundTexture = command.texture;
+            boundBlend = command.blendMode;
+            stateChanges++;
+        }
+
+        if (command.texture) {
+            batch.draw(command.texture, command.srcRect, command.destRect, command.flip,
+                       command.color, command.blendMode);
+        } else {
+            batch.flush();
+            SDL_SetRenderDrawBlendMode(Game::renderer, command.blendMode);
+            SDL_SetRenderDrawColor(Game::renderer, command.color.r, command.color.g, command.color.b, command.color.a);
+            SDL_RenderFillRect(Game::renderer, &command.destRect);
+        }
+    }
+    batch.flush();
+    SDL_SetRenderDrawBlendMode(Game::renderer, SDL_BLENDMODE_NONE);
+
+    for (SDL_Texture* texture : transientTextures) {
+        SDL_DestroyTexture(texture);
+    }
+    transientTextures.clear();
+    textureOrder.clear();
+    sequence = 0;
+    commands.clear();
+}
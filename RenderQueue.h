@@ -0,0 +1,80 @@
+#pragma once
+#include <SDL.h>
+#include <unordered_map>
+#include <vector>
+
+// Draw layers, back to front. Everything in a lower layer is drawn before
+// anything in a higher one; this is the order Game::render used to draw in.
+enum RenderLayer {
+    LAYER_BACKGROUND,
+    LAYER_TILES,
+    LAYER_ENTITIES,
+    LAYER_HUD,
+    LAYER_FADE,
+    LAYER_END_SCREEN,
+    LAYER_EFFECTS,
+    LAYER_DEATH_TEXT,
+    LAYER_PAUSE_BACKDROP,
+    LAYER_PAUSE_TEXT,
+    LAYER_INSTRUCTIONS,
+    LAYER_PROMPT,
+    LAYER_START_BACKDROP,
+    LAYER_START_TEXT
+};
+
+// Singleton collecting the frame's draw commands. execute() sorts them by
+// (layer, texture, blend mode, depth) and replays them through SpriteBatch,
+// so each texture/blend pair in a layer is bound once. Within a layer,
+// untextured fills come first and textures keep their first-submitted order.
+// LAYER_ENTITIES is the exception: sprites there overlap, so it sorts by
+// (depth, submission order) only. Its batches come from consecutive draws
+// sharing a texture (one atlas page in the usual case).
+class RenderQueue {
+public:
+    static RenderQueue& getInstance();
+
+    // Queue a textured quad (srcRect nullptr = whole texture)
+    void submit(RenderLayer layer, SDL_Texture* texture, const SDL_Rect* srcRect, const SDL_Rect& destRect,
+                SDL_RendererFlip flip = SDL_FLIP_NONE,
+                SDL_Color color = SDL_Color{ 255, 255, 255, 255 },
+                SDL_BlendMode blendMode = SDL_BLENDMODE_BLEND, int depth = 0);
+
+    // Queue a texture made for this frame only (e.g. rendered text); destroyed after execute()
+    void submitTransient(RenderLayer layer, SDL_Texture* texture, const SDL_Rect& destRect,
+                         SDL_Color color = SDL_Color{ 255, 255, 255, 255 });
+
+    // Queue a solid rectangle
+    void submitFill(RenderLayer layer, const SDL_Rect& rect, SDL_Color color,
+                    SDL_BlendMode blendMode = SDL_BLENDMODE_BLEND);
+
+    // Sort and draw everything queued this frame, then clear the queue
+    void execute();
+
+    // Texture/blend switches issued by the last execute()
+    int getStateChanges() const { return stateChanges; }
+
+private:
+    RenderQueue();
+    RenderQueue(const RenderQueue&) = delete;
+    RenderQueue& operator=(const RenderQueue&) = delete;
+
+    struct Command {
+        Uint64 key;
+        SDL_Texture* texture;  // nullptr = fill rect
+        SDL_Rect srcRect;
+        SDL_Rect destRect;
+        SDL_RendererFlip flip;
+        SDL_Color color;
+        SDL_BlendMode blendMode;
+    };
+
+    Uint64 makeKey(RenderLayer layer, SDL_Texture* texture, SDL_BlendMode blendMode, int depth);
+    // Layers drawn in submission order instead of grouped by texture
+    static bool keepsSubmissionOrder(RenderLayer layer) { return layer == LAYER_ENTITIES; }
+
+    std::vector<Command> commands;
+    std::vector<SDL_Texture*> transientTextures;
+    std::unordered_map<SDL_Texture*, Uint32> textureOrder;  // First-submitted order this frame
+    Uint32 sequence;  // Commands submitted this frame
+    int stateChanges;
+};
@@ -0,0 +1,151 @@
+#pragma once
+#include <cstdint>
+
+// Game-state snapshot (.snap) layout shared by Game, GameObject and Enemy.
+// Little-endian:
+//   SnapshotHeader
+//   body, LZ4 block compressed or stored:
+//     WorldState
+//     PlayerState
+//     EnemyState[enemyCount]
+// Times are game-clock milliseconds. The game clock is restored along with
+// the state, so the saved start times stay valid as they are. Pending timers
+// can't be written out (they hold callbacks), so each one is saved as the
+// time left before it fires and scheduled again on load.
+namespace SnapshotFormat {
+    const char MAGIC[4] = { 'K', 'F', 'S', 'N' };
+    const std::uint32_t VERSION = 1;
+
+    // Saved in place of a timer's time left when it isn't pending
+    const std::uint32_t NO_TIMER = 0xFFFFFFFF;
+    const int PATH_SIZE = 64;  // Music paths, null-terminated
+
+#pragma pack(push, 1)
+    struct SnapshotHeader {
+        char magic[4];
+        std::uint32_t version;
+        std::uint32_t compression;  // PackFormat::Compression
+        std::uint32_t size;         // Body bytes once decompressed
+        std::uint32_t storedSize;   // Body bytes in the file
+    };
+
+    struct WorldState {
+        double gameTime;
+        std::uint32_t enemyCount;
+        std::int32_t cameraX, cameraY;
+        std::int32_t defeatedEnemyCount;
+        std::int32_t successfulParryCount;
+        std::uint32_t runStartTime;
+        std::uint8_t firstWaveDefeated;
+        std::uint8_t secondMusicStarted;
+        std::uint8_t lockCamera;
+        std::uint8_t showParryText;
+        std::uint32_t parryTextStartTime;
+        std::uint8_t parryTextColor[4];  // RGBA
+        std::uint8_t timerStarted;
+        std::uint8_t hasStartedTimer;
+        std::uint8_t showMasteryAnimation;
+        std::uint8_t isFading;
+        std::uint32_t timerStartTime;
+        std::uint32_t masteryStartTime;
+        std::int32_t masteryFrame;
+        std::uint32_t fadeStartTime;
+        std::uint32_t deathTextStartTime;
+        std::uint8_t fadeAlpha;
+        std::uint8_t showDeathText;
+        std::uint8_t deathTextAlpha;
+        std::uint8_t reserved;
+
+        // Time left on the game-level timers (NO_TIMER = not pending)
+        std::uint32_t parryTextTimer;
+        std::uint32_t roundTimer;
+        std::uint32_t masteryTimer;
+        std::uint32_t fadeTimer;
+
+        // Music playing, the track queued after it (empty = none) and the position in seconds
+        char musicPath[PATH_SIZE];
+        char nextTrack[PATH_SIZE];
+        double musicPosition;
+    };
+
+    struct PlayerState {
+        std::int32_t x, y;
+        std::int32_t prevX, prevY;
+        float velocityX, velocityY;
+        std::uint8_t onGround;
+        std::uint8_t facingRight;
+        std::uint8_t currentState;  // AnimationState
+        std::uint8_t isAttacking;
+        std::uint8_t attackResolved;
+        std::uint8_t isParrying;
+        std::uint8_t isDashing;
+        std::uint8_t isInvincibleDuringDash;
+        std::uint8_t hasParriedDuringDash;
+        std::uint8_t inHitState;
+        std::uint8_t permanentlyDisabled;
+        std::uint8_t isFlashing;
+        std::uint8_t deathCountUpdated;
+        std::uint8_t flashAlpha;
+        std::uint16_t reserved;
+        std::uint32_t attackStartTime;
+        std::int32_t attackDuration;
+        std::uint32_t parryStartTime;
+        std::uint32_t parryDuration;
+        std::uint32_t dashStartTime;
+        std::uint32_t takeHitStartTime;
+        std::int32_t takeHitDuration;
+        std::uint32_t lastAttackTime;
+        std::uint32_t lastParryTime;
+        std::uint32_t lastDashTime;
+        std::uint32_t flashStartTime;
+        std::uint32_t flashDuration;
+        std::int32_t animClip;
+        std::uint32_t animStartTime;
+        std::int32_t currentFrame;
+        std::int32_t enemiesDefeated;
+
+        // Time left on the player's timers (NO_TIMER = not pending)
+        std::uint32_t attackTimer;
+        std::uint32_t parryTimer;
+        std::uint32_t dashTimer;
+        std::uint32_t takeHitTimer;
+        std::uint32_t flashTimer;
+    };
+
+    struct EnemyState {
+        std::int32_t x, y;
+        std::int32_t prevX, prevY;
+        float velocityX, velocityY;
+        float scale;
+        std::uint8_t onGround;
+        std::uint8_t facingRight;
+        std::uint8_t currentState;  // EnemyAnimationState
+        std::uint8_t isInHitState;
+        std::uint8_t isPermanentlyDisabled;
+        std::uint8_t isAttacking;
+        std::uint8_t isFlashing;
+        std::uint8_t flashAlpha;
+        std::uint32_t attackStartTime;
+        std::uint32_t lastAttackTime;
+        std::uint32_t takeHitStartTime;
+        std::uint32_t flashStartTime;
+        std::int32_t animClip;
+        std::uint32_t animStartTime;
+        std::int32_t currentFrame;
+
+        // Time left on the enemy's timers (NO_TIMER = not pending)
+        std::uint32_t attackTimer;
+        std::uint32_t takeHitTimer;
+        std::uint32_t flashTimer;
+    };
+#pragma pack(pop)
+    static_assert(sizeof(SnapshotHeader) == 20, "SnapshotHeader must match the file layout");
+    static_assert(sizeof(WorldState) == 224, "WorldState must match the file layout");
+    static_assert(sizeof(PlayerState) == 124, "PlayerState must match the file layout");
+    static_assert(sizeof(EnemyState) == 76, "EnemyState must match the file layout");
+
+    // Most enemies a snapshot may hold; bounds the body size a reader will accept
+    const std::uint32_t MAX_ENEMIES = 4096;
+    const std::uint32_t MIN_BODY_SIZE = sizeof(WorldState) + sizeof(PlayerState);
+    const std::uint32_t MAX_BODY_SIZE = MIN_BODY_SIZE + MAX_ENEMIES * sizeof(EnemyState);
+}
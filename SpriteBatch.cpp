@@ -0,0 +1,83 @@
+#include "SpriteBatch.h"
+#include "Game.hpp"
+#include <iostream>
+#include <utility>
+
+SpriteBatch& SpriteBatch::getInstance() {
+    static SpriteBatch instance;
+    return instance;
+}
+
+SpriteBatch::SpriteBatch()
+    : texture(nullptr),
+      blendMode(SDL_BLENDMODE_BLEND),
+      invTextureWidth(1.0f),
+      invTextureHeight(1.0f),
+      drawCalls(0)
+{
+    vertices.reserve(4 * 256);
+    indices.reserve(6 * 256);
+}
+
+void SpriteBatch::draw(SDL_Texture* spriteTexture, const SDL_Rect& srcRect, const SDL_Rect& destRect,
+                       SDL_RendererFlip flip, SDL_Color color, SDL_BlendMode spriteBlendMode) {
+    if (!spriteTexture) return;
+
+    if (spriteTexture != texture || spriteBlendMode != blendMode) {
+        flush();
+        texture = spriteTexture;
+        blendMode = spriteBlendMode;
+
+        int width, height;
+        SDL_QueryTexture(texture, NULL, NULL, &width, &height);
+        invTextureWidth = width > 0 ? 1.0f / width : 1.0f;
+        invTextureHeight = height > 0 ? 1.0f / height : 1.0f;
+    }
+
+    float u0 = srcRect.x * invTextureWidth;
+    float v0 = srcRect.y * invTextureHeight;
+    float u1 = (srcRect.x + srcRect.w) * invTextureWidth;
+    float v1 = (srcRect.y + srcRect.h) * invTextureHeight;
+    if (flip & SDL_FLIP_HORIZONTAL) std::swap(u0, u1);
+    if (flip & SDL_FLIP_VERTICAL) std::swap(v0, v1);
+
+    float x0 = static_cast<float>(destRect.x);
+    float y0 = static_cast<float>(destRect.y);
+    float x1 = static_cast<float>(destRect.x + destRect.w);
+    float y1 = static_cast<float>(destRect.y + destRect.h);
+
+    int base = static_cast<int>(vertices.size());
+    vertices.push_back(SDL_Vertex{ { x0, y0 }, color, { u0, v0 } });
+    vertices.push_back(SDL_Vertex{ { x1, y0 }, color, { u1, v0 } });
+    vertices.push_back(SDL_Vertex{ { x1, y1 }, color, { u1, v1 } });
+    vertices.push_back(SDL_Vertex{ { x0, y1 }, color, { u0, v1 } });
+
+    indices.push_back(base);
+    indices.push_back(base + 1);
+    indices.push_back(base + 2);
+    indices.push_back(base);
+    indices.push_back(base + 2);
+    indices.push_back(base + 3);
+}
+
+void SpriteBatch::flush() {
+    // Forget the texture so the next draw queries its size again: a texture
+    // destroyed after this frame can come back at the same address with another size
+    SDL_Texture* batchTexture = texture;
+    texture = nullptr;
+    if (vertices.empty()) return;
+
+    // Color and alpha mods stay neutral; tinting comes from the vertices
+    SDL_SetTextureBlendMode(batchTexture, blendMode);
+    SDL_SetTextureColorMod(batchTexture, 255, 255, 255);
+    SDL_SetTextureAlphaMod(batchTexture, 255);
+
+    if (SDL_RenderGeometry(Game::renderer, batchTexture, vertices.data(), static_cast<int>(vertices.size()),
+                           indices.data(), static_cast<int>(indices.size())) != 0) {
+        std::cout << "Failed to draw sprite batch. Error: " << SDL_GetError() << std::endl;
+    }
+    drawCalls++;
+
+    vertices.clear();
+    indices.clear();
+}
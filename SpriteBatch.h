@@ -0,0 +1,37 @@
+#pragma once
+#include <SDL.h>
+#include <vector>
+
+// Singleton collecting textured quads and submitting them with one
+// SDL_RenderGeometry call per run of the same texture and blend mode.
+// Flip is done by swapping UVs and tint/alpha travel in the vertex color,
+// so no per-sprite texture state changes are needed.
+class SpriteBatch {
+public:
+    static SpriteBatch& getInstance();
+
+    // Queue one sprite; flushes first if texture or blend mode differs from the pending batch
+    void draw(SDL_Texture* texture, const SDL_Rect& srcRect, const SDL_Rect& destRect,
+              SDL_RendererFlip flip = SDL_FLIP_NONE,
+              SDL_Color color = SDL_Color{ 255, 255, 255, 255 },
+              SDL_BlendMode blendMode = SDL_BLENDMODE_BLEND);
+
+    // Submit pending quads. Call before any immediate-mode drawing and before presenting.
+    void flush();
+
+    // Geometry calls issued since the last resetStats()
+    int getDrawCalls() const { return drawCalls; }
+    void resetStats() { drawCalls = 0; }
+
+private:
+    SpriteBatch();
+    SpriteBatch(const SpriteBatch&) = delete;
+    SpriteBatch& operator=(const SpriteBatch&) = delete;
+
+    std::vector<SDL_Vertex> vertices;
+    std::vector<int> indices;
+    SDL_Texture* texture;   // Texture of the pending batch
+    SDL_BlendMode blendMode;
+    float invTextureWidth, invTextureHeight;
+    int drawCalls;
+};
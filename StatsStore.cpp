@@ -0,0 +1,140 @@
+#include "StatsStore.h"
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#endif
+
+StatsStore& StatsStore::getInstance() {
+    static StatsStore instance;
+    return instance;
+}
+
+StatsStore::StatsStore()
+    : stats{ 0, 0, 0, 0, 0 }, writer(nullptr), mutex(SDL_CreateMutex()), saveRequested(SDL_CreateCond()),
+      pendingStats{ 0, 0, 0, 0, 0 }, hasPending(false), stopping(false) { }
+
+StatsStore::~StatsStore() {
+    shutdown();
+    if (saveRequested) SDL_DestroyCond(saveRequested);
+    if (mutex) SDL_DestroyMutex(mutex);
+}
+
+void StatsStore::load(const char* statsPath) {
+    path = statsPath;
+
+    std::ifstream input(path);
+    if (input.is_open()) {
+        std::string key;
+        long long value;
+        while (input >> key >> value) {
+            if (key == "deaths") stats.deaths = static_cast<int>(value);
+            else if (key == "kills") stats.kills = static_cast<int>(value);
+            else if (key == "parries") stats.parries = static_cast<int>(value);
+            else if (key == "best_survival_ms") stats.bestSurvivalTime = static_cast<Uint32>(value);
+            else if (key == "fastest_ten_kills_ms") stats.fastestTenKills = static_cast<Uint32>(value);
+        }
+    } else {
+        // Older versions only kept the death count, in its own file
+        std::ifstream legacy("deathCount.txt");
+        if (legacy >> stats.deaths) {
+            std::cout << "Imported " << stats.deaths << " deaths from deathCount.txt" << std::endl;
+        }
+    }
+
+    if (!writer && mutex && saveRequested) {
+        writer = SDL_CreateThread(writerMain, "StatsWriter", this);
+        if (!writer) {
+            std::cout << "Failed to start stats writer, saving on the main thread. Error: " << SDL_GetError() << std::endl;
+        }
+    }
+}
+
+void StatsStore::recordSurvivalTime(Uint32 time) {
+    if (time > stats.bestSurvivalTime) stats.bestSurvivalTime = time;
+}
+
+void StatsStore::recordTenKills(Uint32 time) {
+    if (stats.fastestTenKills == 0 || time < stats.fastestTenKills) stats.fastestTenKills = time;
+}
+
+void StatsStore::save() {
+    if (path.empty()) return;
+    if (!writer) {
+        writeFile(path, stats);
+        return;
+    }
+
+    // Only the latest counters matter; a save still waiting is simply replaced
+    SDL_LockMutex(mutex);
+    pendingStats = stats;
+    hasPending = true;
+    SDL_CondSignal(saveRequested);
+    SDL_UnlockMutex(mutex);
+}
+
+void StatsStore::shutdown() {
+    if (!writer) return;
+
+    // The writer finishes a pending save before it sees the stop request
+    SDL_LockMutex(mutex);
+    stopping = true;
+    SDL_CondSignal(saveRequested);
+    SDL_UnlockMutex(mutex);
+    SDL_WaitThread(writer, nullptr);
+    writer = nullptr;
+    stopping = false;
+}
+
+int StatsStore::writerMain(void* data) {
+    StatsStore* store = static_cast<StatsStore*>(data);
+    SDL_LockMutex(store->mutex);
+    while (true) {
+        while (!store->hasPending && !store->stopping) {
+            SDL_CondWait(store->saveRequested, store->mutex);
+        }
+        if (!store->hasPending) break;
+
+        PlayerStats snapshot = store->pendingStats;
+        store->hasPending = false;
+        SDL_UnlockMutex(store->mutex);
+
+        writeFile(store->path, snapshot);
+
+        SDL_LockMutex(store->mutex);
+    }
+    SDL_UnlockMutex(store->mutex);
+    return 0;
+}
+
+bool StatsStore::writeFile(const std::string& path, const PlayerStats& stats) {
+    // Write a temp file and rename it over the old one, so a crash never leaves half a file
+    std::string temporary = path + ".tmp";
+    {
+        std::ofstream output(temporary, std::ios::trunc);
+        output << "deaths " << stats.deaths << "\n"
+               << "kills " << stats.kills << "\n"
+               << "parries " << stats.parries << "\n"
+               << "best_survival_ms " << stats.bestSurvivalTime << "\n"
+               << "fastest_ten_kills_ms " << stats.fastestTenKills << "\n";
+        output.flush();
+        if (!output) {
+            std::cout << "Failed to write " << temporary << std::endl;
+            return false;
+        }
+    }
+
+#ifdef _WIN32
+    bool renamed = MoveFileExA(temporary.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+    bool renamed = std::rename(temporary.c_str(), path.c_str()) == 0;
+#endif
+    if (!renamed) {
+        std::cout << "Failed to replace " << path << std::endl;
+        std::remove(temporary.c_str());
+    }
+    return renamed;
+}
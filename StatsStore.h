@@ -0,0 +1,60 @@
+#pragma once
+#include <SDL.h>
+#include <string>
+
+// Lifetime counters kept across sessions
+struct PlayerStats {
+    int deaths;
+    int kills;
+    int parries;
+    Uint32 bestSurvivalTime;  // Longest run in game-time milliseconds (0 = none yet)
+    Uint32 fastestTenKills;   // Quickest run to 10 kills (0 = never reached)
+};
+
+// Singleton stats service. The file is read once at startup and the counters
+// live in memory; save() hands a copy to a writer thread that replaces the
+// file atomically (temp file, then rename). Gameplay and rendering never
+// touch the disk.
+//
+// File (stats.txt): one "key value" pair per line, unknown keys are ignored.
+class StatsStore {
+public:
+    static StatsStore& getInstance();
+
+    // Read the stats file (or import the old deathCount.txt) and start the writer
+    void load(const char* path = "stats.txt");
+    // Write out anything not yet saved and stop the writer
+    void shutdown();
+
+    const PlayerStats& get() const { return stats; }
+
+    void addDeath() { stats.deaths++; }
+    void addKill() { stats.kills++; }
+    void addParry() { stats.parries++; }
+    // Keep the best of a finished run's survival time and its time to 10 kills
+    void recordSurvivalTime(Uint32 time);
+    void recordTenKills(Uint32 time);
+
+    // Queue the current counters for the writer thread; returns immediately
+    void save();
+
+private:
+    StatsStore();
+    ~StatsStore();
+    StatsStore(const StatsStore&) = delete;
+    StatsStore& operator=(const StatsStore&) = delete;
+
+    static int writerMain(void* data);
+    static bool writeFile(const std::string& path, const PlayerStats& stats);
+
+    PlayerStats stats;
+    std::string path;
+
+    // Shared with the writer thread
+    SDL_Thread* writer;
+    SDL_mutex* mutex;
+    SDL_cond* saveRequested;
+    PlayerStats pendingStats;
+    bool hasPending;
+    bool stopping;
+};
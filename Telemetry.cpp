@@ -0,0 +1,143 @@
+#include "Telemetry.h"
+#include "GameClock.h"
+#include "PackFormat.h"
+#include <cstring>
+#include <ctime>
+#include <iostream>
+
+using namespace TelemetryFormat;
+
+Telemetry& Telemetry::getInstance() {
+    static Telemetry instance;
+    return instance;
+}
+
+Telemetry::Telemetry() : dropped(0), writer(nullptr) {
+    SDL_AtomicSet(&head, 0);
+    SDL_AtomicSet(&tail, 0);
+    SDL_AtomicSet(&running, 0);
+}
+
+Telemetry::~Telemetry() {
+    shutdown();
+}
+
+void Telemetry::start(const char* path) {
+    if (writer) return;
+
+    log.open(path, std::ios::binary | std::ios::app);
+    if (!log.is_open()) {
+        std::cout << "Failed to open telemetry log: " << path << std::endl;
+        return;
+    }
+    // A new (empty) log gets the file header; later sessions just append blocks
+    log.seekp(0, std::ios::end);
+    if (log.tellp() == 0) {
+        TelemetryFileHeader header;
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = VERSION;
+        log.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    }
+
+    SDL_AtomicSet(&running, 1);
+    writer = SDL_CreateThread(writerMain, "TelemetryWriter", this);
+    if (!writer) {
+        std::cout << "Failed to start telemetry writer. Error: " << SDL_GetError() << std::endl;
+        SDL_AtomicSet(&running, 0);
+        log.close();
+        return;
+    }
+    record(EVENT_SESSION_START, static_cast<int>(std::time(nullptr)));
+}
+
+void Telemetry::shutdown() {
+    if (!writer) return;
+
+    // The writer drains the ring once more after it sees running drop
+    SDL_AtomicSet(&running, 0);
+    SDL_WaitThread(writer, nullptr);
+    writer = nullptr;
+    log.close();
+    if (dropped > 0) {
+        std::cout << "Telemetry dropped " << dropped << " records (ring full)" << std::endl;
+    }
+}
+
+void Telemetry::record(TelemetryEvent type, int value, int x, int y) {
+    if (!SDL_AtomicGet(&running)) return;
+
+    Uint32 write = static_cast<Uint32>(SDL_AtomicGet(&head));
+    Uint32 read = static_cast<Uint32>(SDL_AtomicGet(&tail));
+    if (write - read >= RING_SIZE) {
+        dropped++;
+        return;
+    }
+
+    const GameClock& clock = GameClock::getInstance();
+    TelemetryRecord& slot = ring[write & (RING_SIZE - 1)];
+    slot.time = clock.now();
+    slot.frameTime = static_cast<std::uint32_t>(clock.frameTime() * 1000.0);
+    slot.type = static_cast<std::uint16_t>(type);
+    slot.reserved = 0;
+    slot.value = value;
+    slot.x = x;
+    slot.y = y;
+
+    // Publishing the new head is what hands the slot to the writer
+    SDL_AtomicSet(&head, static_cast<int>(write + 1));
+}
+
+void Telemetry::drain(std::vector<TelemetryRecord>& batch) {
+    Uint32 read = static_cast<Uint32>(SDL_AtomicGet(&tail));
+    Uint32 write = static_cast<Uint32>(SDL_AtomicGet(&head));
+    for (; read != write; read++) {
+        batch.push_back(ring[read & (RING_SIZE - 1)]);
+    }
+    // Hands the slots back to the game thread
+    SDL_AtomicSet(&tail, static_cast<int>(read));
+}
+
+bool Telemetry::writeBlock(const std::vector<TelemetryRecord>& batch) {
+    const char* raw = reinterpret_cast<const char*>(batch.data());
+    size_t rawSize = batch.size() * sizeof(TelemetryRecord);
+
+    std::vector<char> compressed;
+    bool useLz4 = PackFormat::compressLz4(raw, rawSize, compressed);
+
+    TelemetryBlockHeader header;
+    header.recordCount = static_cast<std::uint32_t>(batch.size());
+    header.compression = useLz4 ? PackFormat::COMPRESSION_LZ4 : PackFormat::COMPRESSION_NONE;
+    header.storedSize = static_cast<std::uint32_t>(useLz4 ? compressed.size() : rawSize);
+    log.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    log.write(useLz4 ? compressed.data() : raw, header.storedSize);
+    log.flush();
+    return static_cast<bool>(log);
+}
+
+int Telemetry::writerMain(void* data) {
+    Telemetry* telemetry = static_cast<Telemetry*>(data);
+    std::vector<TelemetryRecord> batch;
+    batch.reserve(FLUSH_RECORDS * 2);
+    Uint32 lastFlush = SDL_GetTicks();
+    bool failed = false;
+
+    // Poll rather than wait on a signal, so recording never has to wake anything
+    while (SDL_AtomicGet(&telemetry->running)) {
+        SDL_Delay(POLL_INTERVAL);
+        telemetry->drain(batch);
+
+        Uint32 now = SDL_GetTicks();
+        if (batch.size() >= FLUSH_RECORDS || (!batch.empty() && now - lastFlush >= FLUSH_INTERVAL)) {
+            if (!failed && !telemetry->writeBlock(batch)) {
+                std::cout << "Failed to write telemetry, discarding the rest of the session" << std::endl;
+                failed = true;
+            }
+            batch.clear();
+            lastFlush = now;
+        }
+    }
+
+    telemetry->drain(batch);
+    if (!failed && !batch.empty()) telemetry->writeBlock(batch);
+    return 0;
+}
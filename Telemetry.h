@@ -0,0 +1,49 @@
+#pragma once
+#include <SDL.h>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "TelemetryFormat.h"
+
+// Singleton gameplay telemetry. Gameplay code on the game thread pushes
+// fixed-size records into a single-producer/single-consumer ring buffer:
+// no lock, no allocation, no I/O. A writer thread drains the ring, LZ4
+// compresses batches and appends them to telemetry.log; tools/telemetry2csv
+// turns the log into CSV. When the ring is full, records are dropped and counted.
+class Telemetry {
+public:
+    static Telemetry& getInstance();
+
+    // Open the log and start the writer thread; records before this are dropped
+    void start(const char* path = "telemetry.log");
+    // Flush what is left and stop the writer
+    void shutdown();
+
+    // Game thread only
+    void record(TelemetryFormat::TelemetryEvent type, int value = 0, int x = 0, int y = 0);
+
+private:
+    Telemetry();
+    ~Telemetry();
+    Telemetry(const Telemetry&) = delete;
+    Telemetry& operator=(const Telemetry&) = delete;
+
+    static int writerMain(void* data);
+    // Writer thread: move everything in the ring into batch
+    void drain(std::vector<TelemetryFormat::TelemetryRecord>& batch);
+    bool writeBlock(const std::vector<TelemetryFormat::TelemetryRecord>& batch);
+
+    static const Uint32 RING_SIZE = 4096;  // Power of two
+    static const Uint32 FLUSH_RECORDS = 1024;
+    static const Uint32 FLUSH_INTERVAL = 2000;  // ms; a partial batch is written at least this often
+    static const Uint32 POLL_INTERVAL = 100;    // ms between writer wake-ups
+
+    TelemetryFormat::TelemetryRecord ring[RING_SIZE];
+    SDL_atomic_t head;     // Next slot the game thread writes (only it stores)
+    SDL_atomic_t tail;     // Next slot the writer reads (only it stores)
+    SDL_atomic_t running;
+    Uint32 dropped;        // Game thread: records lost to a full ring
+
+    std::ofstream log;     // Writer thread only, once started
+    SDL_Thread* writer;
+};
@@ -0,0 +1,58 @@
+#pragma once
+#include <cstdint>
+
+// Telemetry log (telemetry.log) layout shared by Telemetry and the telemetry2csv tool.
+// Little-endian:
+//   TelemetryFileHeader         (once, when the file is created)
+//   TelemetryBlockHeader + data (appended as the writer flushes, any number)
+// Block data is recordCount TelemetryRecords, LZ4 block compressed or stored.
+// Each game session starts with an EVENT_SESSION_START record.
+namespace TelemetryFormat {
+    const char MAGIC[4] = { 'K', 'F', 'T', 'L' };
+    const std::uint32_t VERSION = 1;
+
+    enum TelemetryEvent {
+        EVENT_SESSION_START = 0,  // value: wall-clock seconds since 1970
+        EVENT_KILL = 1,           // x, y: enemy position
+        EVENT_PARRY = 2,          // value: 1 for a dash parry
+        EVENT_DASH = 3,           // x, y: player position
+        EVENT_DAMAGE_TAKEN = 4,   // x, y: player position
+        EVENT_DEATH = 5,          // value: milliseconds survived
+        EVENT_FRAME_SPIKE = 6,    // value: the long frame's duration in microseconds
+        EVENT_ENEMY_ATTACK = 7,   // x, y: enemy position
+        EVENT_RESTART = 8,
+        EVENT_COUNT
+    };
+
+    // Column names for the CSV tool, by event
+    const char* const EVENT_NAMES[EVENT_COUNT] = {
+        "session_start", "kill", "parry", "dash", "damage_taken",
+        "death", "frame_spike", "enemy_attack", "restart"
+    };
+
+#pragma pack(push, 1)
+    struct TelemetryFileHeader {
+        char magic[4];
+        std::uint32_t version;
+    };
+
+    struct TelemetryBlockHeader {
+        std::uint32_t recordCount;
+        std::uint32_t compression;  // PackFormat::Compression
+        std::uint32_t storedSize;   // Bytes of data that follow
+    };
+
+    struct TelemetryRecord {
+        std::uint32_t time;         // Game time in milliseconds
+        std::uint32_t frameTime;    // Duration of the frame the event happened in, microseconds
+        std::uint16_t type;         // TelemetryEvent
+        std::uint16_t reserved;
+        std::int32_t value;         // Depends on the event
+        std::int32_t x;
+        std::int32_t y;
+    };
+#pragma pack(pop)
+    static_assert(sizeof(TelemetryFileHeader) == 8, "TelemetryFileHeader must match the file layout");
+    static_assert(sizeof(TelemetryBlockHeader) == 12, "TelemetryBlockHeader must match the file layout");
+    static_assert(sizeof(TelemetryRecord) == 24, "TelemetryRecord must match the file layout");
+}
@@ -0,0 +1,218 @@
+#include "TextureAtlas.h"
+#include "TextureManager.h"
+#include "Game.hpp"
+#include "AssetLoader.h"
+#include "TextureCache.h"
+#include <SDL_image.h>
+#include <algorithm>
+#include <iostream>
+
+TextureAtlas::TextureAtlas() : page(nullptr) { }
+
+TextureAtlas::~TextureAtlas() {
+    for (Entry& entry : entries) {
+        if (entry.surface) SDL_FreeSurface(entry.surface);
+        if (entry.flashSurface) SDL_FreeSurface(entry.flashSurface);
+    }
+    if (page) {
+        SDL_DestroyTexture(page);
+        page = nullptr;
+    }
+}
+
+bool TextureAtlas::add(const char* path, int variants) {
+    if (page) {
+        std::cout << "Atlas already built, can't add " << path << std::endl;
+        return false;
+    }
+
+    // Sheets queued on the startup loader arrive decoded and already in RGBA32
+    SDL_Surface* converted = AssetLoader::getInstance().takeSurface(path);
+    if (!converted) {
+        // Keep every image in the page format so blits are plain copies
+        converted = TextureCache::loadImage(path, SDL_PIXELFORMAT_RGBA32);
+        if (!converted) return false;
+    }
+
+    bool mirrored = false;
+    if (variants & ATLAS_MIRROR) {
+        SDL_Surface* withMirror = createMirroredSurface(converted);
+        if (withMirror) {
+            SDL_FreeSurface(converted);
+            converted = withMirror;
+            mirrored = true;
+        }
+    }
+
+    // The flash copy is made last so it covers the mirrored half too
+    SDL_Surface* flash = (variants & ATLAS_FLASH) ? createFlashSurface(converted) : nullptr;
+    entries.push_back(Entry{ path, converted, flash, { 0, 0, converted->w, converted->h },
+                             { 0, 0, flash ? converted->w : 0, flash ? converted->h : 0 }, mirrored });
+    return true;
+}
+
+SDL_Surface* TextureAtlas::createMirroredSurface(SDL_Surface* surface) {
+    SDL_Surface* result = SDL_CreateRGBSurfaceWithFormat(0, surface->w, surface->h * 2, 32, SDL_PIXELFORMAT_RGBA32);
+    if (!result) {
+        std::cout << "Failed to create mirrored sprite. Error: " << SDL_GetError() << std::endl;
+        return nullptr;
+    }
+
+    SDL_LockSurface(surface);
+    SDL_LockSurface(result);
+    for (int y = 0; y < surface->h; y++) {
+        const Uint32* source = reinterpret_cast<const Uint32*>(static_cast<const Uint8*>(surface->pixels) + y * surface->pitch);
+        Uint32* top = reinterpret_cast<Uint32*>(static_cast<Uint8*>(result->pixels) + y * result->pitch);
+        Uint32* bottom = reinterpret_cast<Uint32*>(static_cast<Uint8*>(result->pixels) + (y + surface->h) * result->pitch);
+        for (int x = 0; x < surface->w; x++) {
+            top[x] = source[x];
+            bottom[surface->w - 1 - x] = source[x];
+        }
+    }
+    SDL_UnlockSurface(result);
+    SDL_UnlockSurface(surface);
+    return result;
+}
+
+SDL_Surface* TextureAtlas::createFlashSurface(SDL_Surface* surface) {
+    SDL_Surface* flash = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_RGBA32, 0);
+    if (!flash) {
+        std::cout << "Failed to create flash sprite. Error: " << SDL_GetError() << std::endl;
+        return nullptr;
+    }
+
+    // RGBA32 is R, G, B, A bytes in memory: whiten the color, keep the alpha
+    SDL_LockSurface(flash);
+    for (int y = 0; y < flash->h; y++) {
+        Uint8* pixel = static_cast<Uint8*>(flash->pixels) + y * flash->pitch;
+        for (int x = 0; x < flash->w; x++, pixel += 4) {
+            pixel[0] = 255;
+            pixel[1] = 255;
+            pixel[2] = 255;
+        }
+    }
+    SDL_UnlockSurface(flash);
+    return flash;
+}
+
+bool TextureAtlas::build() {
+    if (page || entries.empty()) return page != nullptr;
+
+    // Shelves are 2048px wide (less if the renderer can't go that wide)
+    int shelfWidth = 2048;
+    int maxWidth = 0;
+    int maxHeight = 0;
+    SDL_RendererInfo info;
+    if (SDL_GetRendererInfo(Game::renderer, &info) == 0) {
+        maxWidth = info.max_texture_width;
+        maxHeight = info.max_texture_height;
+        if (maxWidth > 0) shelfWidth = std::min(shelfWidth, maxWidth);
+    }
+    // Every image and flash copy is a rectangle to place
+    std::vector<SDL_Rect*> order;
+    for (Entry& entry : entries) {
+        order.push_back(&entry.rect);
+        if (entry.flashSurface) order.push_back(&entry.flashRect);
+    }
+
+    // An image wider than the renderer limit can never fit; give up before packing
+    int widest = 0;
+    for (const SDL_Rect* rect : order) {
+        widest = std::max(widest, rect->w);
+    }
+    if (maxWidth > 0 && widest > maxWidth) {
+        std::cout << "Atlas image " << widest << "px wide exceeds the renderer limit of " << maxWidth << "px" << std::endl;
+        return false;
+    }
+    int pageWidth = std::max(widest, shelfWidth);
+
+    // Shelf packing, tallest images first
+    std::stable_sort(order.begin(), order.end(), [](const SDL_Rect* a, const SDL_Rect* b) {
+        return a->h > b->h;
+    });
+
+    int shelfX = 0, shelfY = 0, shelfHeight = 0;
+    for (SDL_Rect* rect : order) {
+        if (shelfX + rect->w > pageWidth) {
+            shelfY += shelfHeight;
+            shelfX = 0;
+            shelfHeight = 0;
+        }
+        rect->x = shelfX;
+        rect->y = shelfY;
+        shelfX += rect->w;
+        shelfHeight = std::max(shelfHeight, rect->h);
+    }
+    int pageHeight = shelfY + shelfHeight;
+    if (maxHeight > 0 && pageHeight > maxHeight) {
+        std::cout << "Atlas page " << pageHeight << "px tall exceeds the renderer limit of " << maxHeight << "px" << std::endl;
+        return false;
+    }
+
+    // Trim unused width on the right
+    int usedWidth = 0;
+    for (const SDL_Rect* rect : order) {
+        usedWidth = std::max(usedWidth, rect->x + rect->w);
+    }
+
+    SDL_Surface* pageSurface = SDL_CreateRGBSurfaceWithFormat(0, usedWidth, pageHeight, 32, SDL_PIXELFORMAT_RGBA32);
+    if (!pageSurface) {
+        std::cout << "Failed to create atlas surface. Error: " << SDL_GetError() << std::endl;
+        return false;
+    }
+    SDL_FillRect(pageSurface, NULL, SDL_MapRGBA(pageSurface->format, 0, 0, 0, 0));
+
+    for (Entry& entry : entries) {
+        // Copy alpha as-is instead of blending onto the empty page
+        SDL_SetSurfaceBlendMode(entry.surface, SDL_BLENDMODE_NONE);
+        SDL_Rect dest = entry.rect;
+        SDL_BlitSurface(entry.surface, NULL, pageSurface, &dest);
+        SDL_FreeSurface(entry.surface);
+        entry.surface = nullptr;
+
+        if (entry.flashSurface) {
+            SDL_SetSurfaceBlendMode(entry.flashSurface, SDL_BLENDMODE_NONE);
+            SDL_Rect flashDest = entry.flashRect;
+            SDL_BlitSurface(entry.flashSurface, NULL, pageSurface, &flashDest);
+            SDL_FreeSurface(entry.flashSurface);
+            entry.flashSurface = nullptr;
+        }
+    }
+
+    page = SDL_CreateTextureFromSurface(Game::renderer, pageSurface);
+    SDL_FreeSurface(pageSurface);
+    if (!page) {
+        std::cout << "Failed to create atlas texture. Error: " << SDL_GetError() << std::endl;
+        return false;
+    }
+    SDL_SetTextureBlendMode(page, SDL_BLENDMODE_BLEND);
+    return true;
+}
+
+AtlasRegion TextureAtlas::find(const char* path) const {
+    if (page) {
+        for (const Entry& entry : entries) {
+            if (entry.path == path) {
+                bool hasFlash = entry.flashRect.w > 0;
+                SDL_Point flashOffset = { entry.flashRect.x - entry.rect.x, entry.flashRect.y - entry.rect.y };
+                SDL_Rect rect = entry.rect;
+                if (entry.mirrored) rect.h /= 2;
+                return AtlasRegion{ page, rect, hasFlash, hasFlash ? flashOffset : SDL_Point{ 0, 0 }, entry.mirrored };
+            }
+        }
+    }
+    return AtlasRegion{ nullptr, { 0, 0, 0, 0 }, false, { 0, 0 }, false };
+}
+
+AtlasRegion TextureAtlas::loadRegion(const TextureAtlas* atlas, const char* path) {
+    if (atlas) {
+        AtlasRegion region = atlas->find(path);
+        if (region.texture) return region;
+    }
+
+    AtlasRegion region = { TextureManager::loadTexture(path), { 0, 0, 0, 0 }, false, { 0, 0 }, false };
+    if (region.texture) {
+        SDL_QueryTexture(region.texture, NULL, NULL, &region.rect.w, &region.rect.h);
+    }
+    return region;
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include <SDL.h>
+#include <string>
+#include <vector>
+
+// A rectangle of a texture: an atlas page region or a whole standalone texture
+struct AtlasRegion {
+    SDL_Texture* texture;
+    SDL_Rect rect;
+    bool hasFlash;          // A white flash copy of the image is packed on the same page
+    SDL_Point flashOffset;  // Offset from rect to the flash copy
+    bool hasMirror;         // A horizontally mirrored copy sits right below rect
+};
+
+// Extra copies add() can pack along with an image
+enum AtlasVariant {
+    ATLAS_FLASH = 1 << 0,   // White silhouette for the hit flash
+    ATLAS_MIRROR = 1 << 1   // Mirrored copy, so left-facing sprites need no flipped draw
+};
+
+// Packs several images into one texture page so sprites from different
+// sheets can be drawn in the same batch. Images are queued with add() and
+// packed into shelves by build().
+class TextureAtlas {
+public:
+    TextureAtlas();
+    ~TextureAtlas();
+
+    // Queue an image for the page; must be called before build().
+    // variants is a mask of AtlasVariant copies to pack with it.
+    bool add(const char* path, int variants = 0);
+
+    // Pack all queued images into the page texture
+    bool build();
+
+    SDL_Texture* getPage() const { return page; }
+
+    // Region of an image packed into this atlas (texture is nullptr if missing)
+    AtlasRegion find(const char* path) const;
+
+    // Region from the atlas if it holds path, otherwise the image loaded as its own texture
+    static AtlasRegion loadRegion(const TextureAtlas* atlas, const char* path);
+
+private:
+    TextureAtlas(const TextureAtlas&) = delete;
+    TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+    struct Entry {
+        std::string path;
+        SDL_Surface* surface;       // Only held until build()
+        SDL_Surface* flashSurface;  // nullptr if no flash copy was requested
+        SDL_Rect rect;              // Image and its mirrored copy below it, if any
+        SDL_Rect flashRect;
+        bool mirrored;
+    };
+
+    // Copy of surface with every pixel turned white, alpha kept
+    static SDL_Surface* createFlashSurface(SDL_Surface* surface);
+    // Surface twice as tall: the image on top, mirrored left to right below
+    static SDL_Surface* createMirroredSurface(SDL_Surface* surface);
+
+    std::vector<Entry> entries;
+    SDL_Texture* page;
+};
@@ -0,0 +1,173 @@
+#include "TextureCache.h"
+#include "AssetPack.h"
+#include "MappedFile.h"
+#include "PackFormat.h"
+#include <SDL_image.h>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace TextureCache {
+    // Set on the main thread before any worker starts, only read afterwards
+    static Uint32 nativeFormat = SDL_PIXELFORMAT_ARGB8888;
+
+    void setNativeFormat(SDL_Renderer* renderer) {
+        SDL_RendererInfo info;
+        if (!renderer || SDL_GetRendererInfo(renderer, &info) != 0) return;
+
+        for (Uint32 i = 0; i < info.num_texture_formats; i++) {
+            Uint32 format = info.texture_formats[i];
+            if (SDL_BITSPERPIXEL(format) == 32 && SDL_ISPIXELFORMAT_ALPHA(format) && !SDL_ISPIXELFORMAT_FOURCC(format)) {
+                nativeFormat = format;
+                return;
+            }
+        }
+    }
+
+    Uint32 getNativeFormat() {
+        return nativeFormat;
+    }
+
+    // Size and modification time of what the image is decoded from: the pack entry or the loose file
+    static bool sourceStamp(const char* path, std::uint64_t& size, std::int64_t& time) {
+        AssetPack& pack = AssetPack::getInstance();
+        std::error_code error;
+        fs::file_time_type modified;
+        size_t packedSize;
+        if (pack.getSize(path, packedSize)) {
+            size = packedSize;
+            modified = fs::last_write_time(pack.getPath(), error);
+        } else {
+            size = fs::file_size(path, error);
+            if (!error) modified = fs::last_write_time(path, error);
+        }
+        if (error) return false;
+        time = static_cast<std::int64_t>(modified.time_since_epoch().count());
+        return true;
+    }
+
+    static std::string cachePath(const char* path, Uint32 format) {
+        std::string name(path);
+        for (char& c : name) {
+            if (c == '/' || c == '\\' || c == ' ' || c == ':') c = '_';
+        }
+        char suffix[16];
+        SDL_snprintf(suffix, sizeof(suffix), ".%08x.tex", format);
+        return std::string(DIRECTORY) + "/" + name + suffix;
+    }
+
+    static SDL_Surface* readCache(const std::string& file, Uint32 format, std::uint64_t sourceSize, std::int64_t sourceTime) {
+        std::error_code error;
+        if (!fs::is_regular_file(file, error)) return nullptr;
+
+        MappedFile mapped;
+        if (!mapped.open(file.c_str())) return nullptr;
+
+        CacheHeader header;
+        if (mapped.getSize() < sizeof(header)) return nullptr;
+        std::memcpy(&header, mapped.getData(), sizeof(header));
+        size_t pixelBytes = static_cast<size_t>(header.width) * header.height * 4;
+        bool fresh = std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) == 0 && header.version == VERSION &&
+                     header.format == format && header.sourceSize == sourceSize && header.sourceTime == sourceTime &&
+                     header.width > 0 && header.height > 0 && header.dataSize == mapped.getSize() - sizeof(header) &&
+                     (header.compression == PackFormat::COMPRESSION_LZ4 || header.dataSize == pixelBytes);
+        if (!fresh) return nullptr;
+
+        SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, header.width, header.height, 32, format);
+        if (!surface) return nullptr;
+
+        // Rows are packed in the file; the surface pitch of a 32-bit format is the same width * 4
+        const char* pixels = mapped.getData() + sizeof(header);
+        bool ok = surface->pitch == static_cast<int>(header.width * 4);
+        if (ok && header.compression == PackFormat::COMPRESSION_LZ4) {
+            ok = PackFormat::decompressLz4(pixels, static_cast<size_t>(header.dataSize),
+                                           static_cast<char*>(surface->pixels), pixelBytes);
+        } else if (ok) {
+            std::memcpy(surface->pixels, pixels, pixelBytes);
+        }
+        if (!ok) {
+            SDL_FreeSurface(surface);
+            return nullptr;
+        }
+        return surface;
+    }
+
+    static void writeCache(const std::string& file, SDL_Surface* surface, Uint32 format,
+                           std::uint64_t sourceSize, std::int64_t sourceTime) {
+        std::error_code error;
+        fs::create_directories(DIRECTORY, error);
+
+        // Packed rows, then LZ4 if that is worth it (PNGs with large flat areas usually are)
+        size_t rowBytes = static_cast<size_t>(surface->w) * 4;
+        std::vector<char> pixels(rowBytes * surface->h);
+        for (int y = 0; y < surface->h; y++) {
+            std::memcpy(pixels.data() + y * rowBytes, static_cast<const char*>(surface->pixels) + y * surface->pitch, rowBytes);
+        }
+        std::vector<char> compressed;
+        bool useLz4 = PackFormat::compressLz4(pixels.data(), pixels.size(), compressed) &&
+                      compressed.size() <= pixels.size() - pixels.size() / 8;
+        const std::vector<char>& data = useLz4 ? compressed : pixels;
+
+        CacheHeader header;
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = VERSION;
+        header.format = format;
+        header.width = static_cast<std::uint32_t>(surface->w);
+        header.height = static_cast<std::uint32_t>(surface->h);
+        header.compression = useLz4 ? PackFormat::COMPRESSION_LZ4 : PackFormat::COMPRESSION_NONE;
+        header.sourceSize = sourceSize;
+        header.sourceTime = sourceTime;
+        header.dataSize = data.size();
+
+        // Write beside it and rename, so a crash or another thread never sees half a file
+        std::string temporary = file + "." + std::to_string(SDL_ThreadID()) + ".tmp";
+        {
+            std::ofstream output(temporary, std::ios::binary);
+            output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            output.write(data.data(), static_cast<std::streamsize>(data.size()));
+            if (!output) {
+                std::cout << "Failed to write texture cache: " << file << std::endl;
+                output.close();
+                fs::remove(temporary, error);
+                return;
+            }
+        }
+        fs::rename(temporary, file, error);
+        if (error) {
+            std::cout << "Failed to write texture cache: " << file << ". Error: " << error.message() << std::endl;
+            fs::remove(temporary, error);
+        }
+    }
+
+    SDL_Surface* loadImage(const char* path, Uint32 format) {
+        std::uint64_t sourceSize = 0;
+        std::int64_t sourceTime = 0;
+        bool cacheable = sourceStamp(path, sourceSize, sourceTime);
+        std::string file = cachePath(path, format);
+
+        if (cacheable) {
+            SDL_Surface* cached = readCache(file, format, sourceSize, sourceTime);
+            if (cached) return cached;
+        }
+
+        SDL_Surface* loaded = IMG_Load_RW(AssetPack::getInstance().openAsset(path), 1);
+        if (!loaded) {
+            std::cout << "Failed to load image: " << path << ". Error: " << IMG_GetError() << std::endl;
+            return nullptr;
+        }
+        SDL_Surface* converted = SDL_ConvertSurfaceFormat(loaded, format, 0);
+        SDL_FreeSurface(loaded);
+        if (!converted) {
+            std::cout << "Failed to convert image: " << path << ". Error: " << SDL_GetError() << std::endl;
+            return nullptr;
+        }
+
+        if (cacheable) writeCache(file, converted, format, sourceSize, sourceTime);
+        return converted;
+    }
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <SDL.h>
+#include <cstdint>
+
+// On-disk cache of decoded images, already in the pixel format they are
+// used in (the renderer's native format for textures, RGBA32 for atlas
+// sheets). A warm start reads the pixels straight back instead of inflating
+// the PNG and converting it. Entries are keyed by the source's size and
+// modification time (the pack's, for packed assets) and rebuilt when it changes.
+//
+// Cache file (cache/<path>.<format>.tex), little-endian:
+//   CacheHeader
+//   pixels, rows of width * 4 bytes, raw or LZ4 block compressed
+namespace TextureCache {
+    const char MAGIC[4] = { 'K', 'F', 'T', 'X' };
+    const std::uint32_t VERSION = 1;
+    const char* const DIRECTORY = "cache";
+
+#pragma pack(push, 1)
+    struct CacheHeader {
+        char magic[4];
+        std::uint32_t version;
+        std::uint32_t format;       // SDL_PixelFormatEnum of the pixels
+        std::uint32_t width;
+        std::uint32_t height;
+        std::uint32_t compression;  // PackFormat::Compression
+        std::uint64_t sourceSize;
+        std::int64_t sourceTime;
+        std::uint64_t dataSize;     // Bytes of pixel data that follow
+    };
+#pragma pack(pop)
+    static_assert(sizeof(CacheHeader) == 48, "CacheHeader must match the file layout");
+
+    // Pick the renderer's preferred 32-bit format with alpha; call once after creating it
+    void setNativeFormat(SDL_Renderer* renderer);
+    Uint32 getNativeFormat();
+
+    // Image at path as a surface in format: from the cache if it is fresh, otherwise
+    // decoded from the PNG and written to the cache. nullptr if it can't be loaded.
+    // Safe to call from the asset loader's worker threads.
+    SDL_Surface* loadImage(const char* path, Uint32 format);
+}
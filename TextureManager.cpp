@@ -1,5 +1,7 @@
 #include "TextureManager.h"
 #include "Game.hpp"
+#include "AssetLoader.h"
+#include "TextureCache.h"
 #include <SDL_image.h>
 #include <iostream>
 #include <vector>
@@ -12,9 +14,16 @@ namespace {
 }
 
 SDL_Texture* TextureManager::loadTexture(const char* filePath) {
-    SDL_Surface* tempSurface = IMG_Load(filePath);
+    // Already decoded and uploaded by the startup loader
+    SDL_Texture* preloaded = AssetLoader::getInstance().takeTexture(filePath);
+    if (preloaded) {
+        loadedTextures.push_back(preloaded);
+        return preloaded;
+    }
+
+    // Already in the renderer's format, so creating the texture is a plain upload
+    SDL_Surface* tempSurface = TextureCache::loadImage(filePath, TextureCache::getNativeFormat());
     if (!tempSurface) {
-        std::cout << "Failed to load image: " << filePath << ". Error: " << IMG_GetError() << std::endl;
         return nullptr;
     }
 
@@ -1,15 +1,37 @@
 #include "TileMap.hpp"
 #include "TextureManager.h"
+#include "SpriteBatch.h"
+#include "RenderQueue.h"
 #include "Game.hpp"
 #include <SDL.h>
+#include "MappedFile.h"
+#include "AssetPack.h"
+#include "LevelFormat.h"
+#include <filesystem>
 #include <iostream>
-#include <fstream>
+#include <utility>
 
-// Definition for the static grid member using hardcoded values instead of Game:: constants
-int TileMap::grid[64][64];
+namespace fs = std::filesystem;
 
-// Update levelData array with only the Final ground level
-int levelData[64][64] = {
+static const char* LEVEL_BINARY_PATH = "assets/level1.lvl";
+static const char* LEVEL_TEXT_PATH = "assets/level1.map";
+
+// True if the loose text level was saved after the binary one was built from it
+static bool isTextLevelNewer() {
+    // A packed level has no date; the pack is built from the current files
+    size_t packedSize;
+    if (AssetPack::getInstance().getSize(LEVEL_BINARY_PATH, packedSize)) return false;
+
+    std::error_code error;
+    fs::file_time_type textTime = fs::last_write_time(LEVEL_TEXT_PATH, error);
+    if (error) return false;
+    fs::file_time_type binaryTime = fs::last_write_time(LEVEL_BINARY_PATH, error);
+    if (error) return false;
+    return textTime > binaryTime;
+}
+
+// Built-in level, used when neither assets/level1.lvl nor assets/level1.map can be loaded
+static const int levelData[64][64] = {
     // Clear most of the map (empty space)
     {3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3},
     {3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3},
@@ -49,7 +71,15 @@ int levelData[64][64] = {
     {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
 };
 
-TileMap::TileMap() {
+TileMap::TileMap()
+    : chunkCols(0),
+      chunkRows(0),
+      cachedChunkCount(0),
+      drawCounter(0),
+      bakingSupported(true),
+      rows(0),
+      cols(0)
+{
     // Use TextureManager to load the tileset
     tileSetTexture = TextureManager::loadTexture("assets/Tileset.png");
     if (!tileSetTexture) {
@@ -63,7 +93,19 @@ TileMap::TileMap() {
         std::cout << "Error: Failed to load decors texture assets/Decors.png" << std::endl;
     }
 
-    loadMap(levelData);
+    // Prefer the compact binary level, unless the editable text one was changed since
+    // mapconv last built it; then load the text and say so, since the .lvl is out of date
+    const char* firstPath = LEVEL_BINARY_PATH;
+    const char* secondPath = LEVEL_TEXT_PATH;
+    if (isTextLevelNewer()) {
+        std::cout << "Warning: " << LEVEL_TEXT_PATH << " is newer than " << LEVEL_BINARY_PATH
+                  << ", loading the text level. Run mapconv to rebuild the binary one." << std::endl;
+        std::swap(firstPath, secondPath);
+    }
+    if (!loadMap(firstPath) && !loadMap(secondPath)) {
+        std::cout << "Using the built-in level" << std::endl;
+        loadDefaultMap();
+    }
 
     // srcRect and destRect will be set dynamically in drawMap
     srcRect = { 0, 0, Game::TILE_SIZE, Game::TILE_SIZE };
@@ -71,6 +113,8 @@ TileMap::TileMap() {
 }
 
 TileMap::~TileMap() {
+    destroyChunks();
+
     // Destroy the texture if TextureManager doesn't handle it
     // Although TextureManager usually implies ownership, be safe if unsure.
     if (tileSetTexture) {
@@ -83,12 +127,52 @@ TileMap::~TileMap() {
     }
 }
 
-void TileMap::loadMap(int arr[64][64]) {
-    for (int row = 0; row < 64; row++) {
-        for (int col = 0; col < 64; col++) {
-            grid[row][col] = arr[row][col];
-        }
+bool TileMap::loadMap(const char* path) {
+    Uint64 startCounter = SDL_GetPerformanceCounter();
+
+    // Read from the asset pack if the level is packed, otherwise map the loose file
+    const char* data;
+    size_t size;
+    MappedFile file;
+    if (!AssetPack::getInstance().find(path, data, size)) {
+        if (!file.open(path)) return false;
+        data = file.getData();
+        size = file.getSize();
     }
+
+    // Decode into a scratch grid so a broken file leaves the current map untouched
+    int mapRows = 0, mapCols = 0;
+    std::vector<int> tiles;
+    bool loaded = LevelFormat::isBinary(data, size)
+        ? LevelFormat::decodeBinary(data, size, mapRows, mapCols, tiles)
+        : LevelFormat::parseText(data, size, mapRows, mapCols, tiles);
+    if (!loaded) {
+        std::cout << "Failed to load level " << path << std::endl;
+        return false;
+    }
+
+    grid.swap(tiles);
+    rows = mapRows;
+    cols = mapCols;
+    resetChunks();
+
+    double elapsed = static_cast<double>(SDL_GetPerformanceCounter() - startCounter) * 1000.0 / SDL_GetPerformanceFrequency();
+    std::cout << "Loaded level " << path << " (" << rows << "x" << cols << ") in " << elapsed << " ms" << std::endl;
+    return true;
+}
+
+void TileMap::loadDefaultMap() {
+    rows = 64;
+    cols = 64;
+    grid.assign(&levelData[0][0], &levelData[0][0] + rows * cols);
+    resetChunks();
+}
+
+void TileMap::resetChunks() {
+    destroyChunks();
+    chunkCols = (cols + CHUNK_TILES - 1) / CHUNK_TILES;
+    chunkRows = (rows + CHUNK_TILES - 1) / CHUNK_TILES;
+    chunks.assign(chunkCols * chunkRows, Chunk{nullptr, true, 0});
 }
 
 void TileMap::drawMap() {
@@ -96,12 +180,173 @@ void TileMap::drawMap() {
     drawMap(0, 0);
 }
 
-void TileMap::drawMap(int cameraX, int cameraY) {
-    if (!tileSetTexture || !decorsTexture) return;
+void TileMap::setTile(int row, int col, int tileID) {
+    if (row < 0 || row >= rows || col < 0 || col >= cols) return;
+    int& tile = grid[row * cols + col];
+    if (tile == tileID) return;
+    tile = tileID;
+
+    // Decor reaches up to 3 tiles above and 2 tiles right of its cell (trees),
+    // so dirty every chunk that area touches
+    int firstChunkRow = std::max(0, row - 3) / CHUNK_TILES;
+    int lastChunkRow = row / CHUNK_TILES;
+    int firstChunkCol = col / CHUNK_TILES;
+    int lastChunkCol = std::min(cols - 1, col + 2) / CHUNK_TILES;
+    for (int chunkRow = firstChunkRow; chunkRow <= lastChunkRow; chunkRow++) {
+        for (int chunkCol = firstChunkCol; chunkCol <= lastChunkCol; chunkCol++) {
+            chunks[chunkRow * chunkCols + chunkCol].dirty = true;
+        }
+    }
+}
+
+void TileMap::invalidate() {
+    for (Chunk& chunk : chunks) {
+        chunk.dirty = true;
+    }
+}
+
+void TileMap::destroyChunks() {
+    for (Chunk& chunk : chunks) {
+        if (chunk.texture) {
+            SDL_DestroyTexture(chunk.texture);
+            chunk.texture = nullptr;
+        }
+        chunk.dirty = true;
+    }
+    cachedChunkCount = 0;
+}
+
+void TileMap::evictChunks(int maxCached) {
+    while (cachedChunkCount > maxCached) {
+        Chunk* oldest = nullptr;
+        for (Chunk& chunk : chunks) {
+            // Never evict a chunk drawn this frame
+            if (chunk.texture && chunk.lastUsed != drawCounter &&
+                (!oldest || chunk.lastUsed < oldest->lastUsed)) {
+                oldest = &chunk;
+            }
+        }
+        if (!oldest) return;
+
+        SDL_DestroyTexture(oldest->texture);
+        oldest->texture = nullptr;
+        oldest->dirty = true;
+        cachedChunkCount--;
+    }
+}
+
+bool TileMap::bakeChunk(int chunkCol, int chunkRow) {
+    Chunk& chunk = chunks[chunkRow * chunkCols + chunkCol];
+
+    if (!chunk.texture) {
+        // Make room first so the cache never exceeds its budget
+        evictChunks(MAX_CACHED_CHUNKS - 1);
+        chunk.texture = SDL_CreateTexture(Game::renderer, SDL_PIXELFORMAT_RGBA8888,
+                                          SDL_TEXTUREACCESS_TARGET, CHUNK_SIZE, CHUNK_SIZE);
+        if (!chunk.texture) {
+            std::cout << "Failed to create tile map chunk, drawing per tile. Error: " << SDL_GetError() << std::endl;
+            return false;
+        }
+        SDL_SetTextureBlendMode(chunk.texture, SDL_BLENDMODE_BLEND);
+        cachedChunkCount++;
+    }
+
+    // Anything already queued belongs to the previous target
+    SpriteBatch& batch = SpriteBatch::getInstance();
+    batch.flush();
+
+    SDL_Texture* previousTarget = SDL_GetRenderTarget(Game::renderer);
+    if (SDL_SetRenderTarget(Game::renderer, chunk.texture) != 0) {
+        std::cout << "Failed to bake tile map chunk. Error: " << SDL_GetError() << std::endl;
+        return false;
+    }
+
+    // Start from a fully transparent chunk
+    Uint8 r, g, b, a;
+    SDL_GetRenderDrawColor(Game::renderer, &r, &g, &b, &a);
+    SDL_SetRenderDrawColor(Game::renderer, 0, 0, 0, 0);
+    SDL_RenderClear(Game::renderer);
+
+    // Include the cells whose decor overhangs into this chunk from below and from the left
+    int originX = chunkCol * CHUNK_SIZE;
+    int originY = chunkRow * CHUNK_SIZE;
+    int startCol = std::max(0, chunkCol * CHUNK_TILES - 2);
+    int endCol = std::min(cols, (chunkCol + 1) * CHUNK_TILES);
+    int startRow = chunkRow * CHUNK_TILES;
+    int endRow = std::min(rows, (chunkRow + 1) * CHUNK_TILES + 3);
+
+    for (int pass = 0; pass < 2; pass++) {
+        for (int row = startRow; row < endRow; row++) {
+            for (int col = startCol; col < endCol; col++) {
+                drawTile(row, col, col * Game::TILE_SIZE - originX, row * Game::TILE_SIZE - originY, pass == 1, true);
+            }
+        }
+    }
+    batch.flush();
+
+    SDL_SetRenderTarget(Game::renderer, previousTarget);
+    SDL_SetRenderDrawColor(Game::renderer, r, g, b, a);
+    chunk.dirty = false;
+    return true;
+}
+
+void TileMap::drawTile(int row, int col, int destX, int destY, bool decorPass, bool baking) {
+    const int TILE_SIZE = Game::TILE_SIZE;
+    int tileID = grid[row * cols + col];
+
+    // Ground tiles go on the ground layer, decor (4+) on the decor layer
+    if ((tileID >= 4) != decorPass) return;
+
+    destRect.x = destX;
+    destRect.y = destY;
+    destRect.w = TILE_SIZE;
+    destRect.h = TILE_SIZE;
+
+    srcRect.w = TILE_SIZE;
+    srcRect.h = TILE_SIZE;
+
+    switch (tileID) {
+        case 0: srcRect.x = 1 * TILE_SIZE; srcRect.y = 1 * TILE_SIZE; break;
+        case 1: srcRect.x = 1 * TILE_SIZE; srcRect.y = 0 * TILE_SIZE; break;
+        case 3: return;
+        case 4: // Tree
+            srcRect.x = 10;
+            srcRect.y = 15;
+            srcRect.w = 205;
+            srcRect.h = 245;
+            destRect.w = TILE_SIZE * 3;
+            destRect.h = TILE_SIZE * 4;
+            destRect.y -= TILE_SIZE * 3;
+            break;
+        case 5: // Bush
+            srcRect.x = 315;
+            srcRect.y = 215;
+            srcRect.w = 70;
+            srcRect.h = 48;
+            destRect.h = TILE_SIZE;
+            destRect.y -= TILE_SIZE/2;
+            break;
+        case 6: // Stone Wall
+            srcRect.x = 420;
+            srcRect.y = 225;
+            srcRect.w = 58;
+            srcRect.h = 43;
+            destRect.h = TILE_SIZE;
+            destRect.y -= TILE_SIZE/3;
+            break;
+        default: return;
+    }
+
+    SDL_Texture* currentTexture = decorPass ? decorsTexture : tileSetTexture;
+    if (baking) {
+        SpriteBatch::getInstance().draw(currentTexture, srcRect, destRect);
+    } else {
+        RenderQueue::getInstance().submit(LAYER_TILES, currentTexture, &srcRect, destRect);
+    }
+}
 
+void TileMap::drawTiles(int cameraX, int cameraY, int screenWidth, int screenHeight) {
     const int TILE_SIZE = Game::TILE_SIZE;
-    const int screenWidth = 720;
-    const int screenHeight = 576;
 
     int startCol = cameraX / TILE_SIZE;
     int endCol = (cameraX + screenWidth) / TILE_SIZE + 1;
@@ -109,61 +354,55 @@ void TileMap::drawMap(int cameraX, int cameraY) {
     int endRow = (cameraY + screenHeight) / TILE_SIZE + 1;
 
     startCol = std::max(0, startCol);
-    endCol = std::min(64, endCol);
+    endCol = std::min(cols, endCol);
     startRow = std::max(0, startRow);
-    endRow = std::min(64, endRow);
+    endRow = std::min(rows, endRow);
 
-    // Draw base tiles first
-    for (int row = startRow; row < endRow; row++) {
-        for (int col = startCol; col < endCol; col++) {
-            int tileID = grid[row][col];
+    // Ground first, then decor so it overlaps neighbouring cells
+    for (int pass = 0; pass < 2; pass++) {
+        for (int row = startRow; row < endRow; row++) {
+            for (int col = startCol; col < endCol; col++) {
+                drawTile(row, col, col * TILE_SIZE - cameraX, row * TILE_SIZE - cameraY, pass == 1, false);
+            }
+        }
+    }
+}
 
-            destRect.x = col * TILE_SIZE - cameraX;
-            destRect.y = row * TILE_SIZE - cameraY;
-            destRect.w = TILE_SIZE;
-            destRect.h = TILE_SIZE;
+void TileMap::drawMap(int cameraX, int cameraY) {
+    if (!tileSetTexture || !decorsTexture) return;
 
-            srcRect.w = TILE_SIZE;
-            srcRect.h = TILE_SIZE;
-
-            bool drawTile = true;
-
-            switch (tileID) {
-                case 0: srcRect.x = 1 * TILE_SIZE; srcRect.y = 1 * TILE_SIZE; break;
-                case 1: srcRect.x = 1 * TILE_SIZE; srcRect.y = 0 * TILE_SIZE; break;
-                case 3: drawTile = false; break;
-                case 4: // Tree
-                    srcRect.x = 10;
-                    srcRect.y = 15;
-                    srcRect.w = 205;
-                    srcRect.h = 245;
-                    destRect.w = TILE_SIZE * 3;
-                    destRect.h = TILE_SIZE * 4;
-                    destRect.y -= TILE_SIZE * 3;
-                    break;
-                case 5: // Bush
-                    srcRect.x = 315;
-                    srcRect.y = 215;
-                    srcRect.w = 70;
-                    srcRect.h = 48;
-                    destRect.h = TILE_SIZE;
-                    destRect.y -= TILE_SIZE/2;
-                    break;
-                case 6: // Stone Wall
-                    srcRect.x = 420;
-                    srcRect.y = 225;
-                    srcRect.w = 58;
-                    srcRect.h = 43;
-                    destRect.h = TILE_SIZE;
-                    destRect.y -= TILE_SIZE/3;
-                    break;
-                default: drawTile = false; break;
-            }
+    // The view is the logical screen, whatever size the window is
+    const int screenWidth = Game::SCREEN_WIDTH;
+    const int screenHeight = Game::SCREEN_HEIGHT;
 
-            if (drawTile) {
-                SDL_Texture* currentTexture = (tileID >= 4) ? decorsTexture : tileSetTexture;
-                SDL_RenderCopy(Game::renderer, currentTexture, &srcRect, &destRect);
+    if (!bakingSupported) {
+        drawTiles(cameraX, cameraY, screenWidth, screenHeight);
+        return;
+    }
+
+    // Chunks overlapping the view
+    int startChunkCol = std::max(0, cameraX / CHUNK_SIZE);
+    int endChunkCol = std::min(chunkCols, (cameraX + screenWidth) / CHUNK_SIZE + 1);
+    int startChunkRow = std::max(0, cameraY / CHUNK_SIZE);
+    int endChunkRow = std::min(chunkRows, (cameraY + screenHeight) / CHUNK_SIZE + 1);
+
+    drawCounter++;
+    for (int chunkRow = startChunkRow; chunkRow < endChunkRow; chunkRow++) {
+        for (int chunkCol = startChunkCol; chunkCol < endChunkCol; chunkCol++) {
+            Chunk& chunk = chunks[chunkRow * chunkCols + chunkCol];
+            chunk.lastUsed = drawCounter;
+
+            if ((!chunk.texture || chunk.dirty) && !bakeChunk(chunkCol, chunkRow)) {
+                // Render targets don't work here: drop the cache and draw per tile from now on
+                bakingSupported = false;
+                destroyChunks();
+                drawTiles(cameraX, cameraY, screenWidth, screenHeight);
+                return;
             }
+
+            SDL_Rect chunkRect = { chunkCol * CHUNK_SIZE - cameraX, chunkRow * CHUNK_SIZE - cameraY,
+                                   CHUNK_SIZE, CHUNK_SIZE };
+            RenderQueue::getInstance().submit(LAYER_TILES, chunk.texture, nullptr, chunkRect);
         }
     }
 }
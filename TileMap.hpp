@@ -1,6 +1,7 @@
 #pragma once
 #include <SDL.h>
 #include "Game.hpp"
+#include <vector>
 
 // Handles tile map loading and rendering
 class TileMap {
@@ -13,17 +14,61 @@ public:
     void drawMap(int cameraX, int cameraY);
     void render(int cameraX, int cameraY) { drawMap(cameraX, cameraY); }
     
-    // Access the map data
-    int (*getMapMatrix())[64] { return grid; }
+    // Replace the map with a level file, binary (.lvl) or text (.map), see LevelFormat.h
+    bool loadMap(const char* path);
+
+    // Map size in tiles and in pixels
+    int getRows() const { return rows; }
+    int getCols() const { return cols; }
+    int getWidth() const { return cols * Game::TILE_SIZE; }
+    int getHeight() const { return rows * Game::TILE_SIZE; }
+
+    int getTile(int row, int col) const { return grid[row * cols + col]; }
+    void setTile(int row, int col, int tileID);
+
+    // Rebuild every cached chunk before it is drawn again (map edited or render targets lost)
+    void invalidate();
 
 private:
     SDL_Texture* tileSetTexture;  // Main tileset image
     SDL_Texture* decorsTexture;   // Decorative elements image
     SDL_Rect srcRect, destRect;   // Source and destination rectangles for rendering
+
+    // The map is cached as CHUNK_TILES x CHUNK_TILES blocks, each baked lazily
+    // into its own target texture (ground, then decor on top)
+    struct Chunk {
+        SDL_Texture* texture;
+        bool dirty;
+        Uint32 lastUsed;  // drawCounter value of the last frame it was drawn
+    };
+    static const int CHUNK_TILES = 16;
+    static const int CHUNK_SIZE = CHUNK_TILES * Game::TILE_SIZE;  // Chunk edge in pixels
+    static const int MAX_CACHED_CHUNKS = 24;         // Textures kept before LRU eviction
+    std::vector<Chunk> chunks;
+    int chunkCols, chunkRows;
+    int cachedChunkCount;
+    Uint32 drawCounter;
+    bool bakingSupported;  // Cleared if the renderer can't use target textures
     
-    // Map grid with fixed dimensions
-    static int grid[64][64];
-    
-    // Load map data from file
-    void loadMap(int arr[64][64]);
+    // Map grid, row-major
+    std::vector<int> grid;
+    int rows, cols;
+
+    // Use the built-in level (when the level file is missing or broken)
+    void loadDefaultMap();
+    // Size the chunk cache for the current map
+    void resetChunks();
+
+    // Render every tile overlapping the chunk into its texture
+    bool bakeChunk(int chunkCol, int chunkRow);
+    // Free least recently drawn chunk textures until at most maxCached remain
+    void evictChunks(int maxCached);
+    void destroyChunks();
+
+    // Draw one cell at (destX, destY) if it belongs to the requested layer.
+    // Baking draws straight into the bound chunk target, otherwise it is queued for the frame.
+    void drawTile(int row, int col, int destX, int destY, bool decorPass, bool baking);
+
+    // Per-tile drawing of the visible cells (used when baking is unavailable)
+    void drawTiles(int cameraX, int cameraY, int screenWidth, int screenHeight);
 };
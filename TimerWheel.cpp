@@ -0,0 +1,190 @@
+#include "TimerWheel.h"
+#include "GameClock.h"
+#include <utility>
+
+TimerWheel& TimerWheel::getInstance() {
+    static TimerWheel instance;
+    return instance;
+}
+
+TimerWheel::TimerWheel() : currentTime(0), activeCount(0), started(false) { }
+
+TimerWheel::TimerId TimerWheel::schedule(Uint32 delayMs, std::function<void()> callback) {
+    return scheduleAt(GameClock::getInstance().now() + delayMs, std::move(callback));
+}
+
+TimerWheel::TimerId TimerWheel::scheduleAt(Uint32 timeMs, std::function<void()> callback) {
+    if (!started) {
+        currentTime = GameClock::getInstance().now();
+        started = true;
+    }
+
+    Uint32 index;
+    if (!freeList.empty()) {
+        index = freeList.back();
+        freeList.pop_back();
+    } else {
+        index = static_cast<Uint32>(timers.size());
+        if (index >= 0xFFFF) return INVALID_TIMER;  // Handle space exhausted
+        timers.push_back(Timer{0, 0, false, nullptr});
+    }
+
+    Timer& timer = timers[index];
+    timer.expiry = timeMs;
+    timer.active = true;
+    timer.callback = std::move(callback);
+    activeCount++;
+
+    insert(index);
+    return (static_cast<TimerId>(timer.generation) << 16) | (index + 1);
+}
+
+void TimerWheel::cancel(TimerId& id) {
+    if (lookup(id)) {
+        release((id & 0xFFFF) - 1);
+    }
+    id = INVALID_TIMER;
+}
+
+bool TimerWheel::isPending(TimerId id) const {
+    return lookup(id) != nullptr;
+}
+
+Uint32 TimerWheel::remaining(TimerId id) const {
+    const Timer* timer = lookup(id);
+    if (!timer) return 0;
+    Uint32 now = GameClock::getInstance().now();
+    return (timer->expiry > now) ? timer->expiry - now : 0;
+}
+
+void TimerWheel::advance(Uint32 nowMs) {
+    if (!started) {
+        currentTime = nowMs;
+        started = true;
+    }
+
+    if (!overdue.empty()) {
+        std::vector<SlotEntry> due;
+        due.swap(overdue);
+        fire(due);
+    }
+
+    while (currentTime < nowMs) {
+        // Nothing pending - jump straight to the target time
+        if (activeCount == 0) {
+            currentTime = nowMs;
+            break;
+        }
+
+        currentTime++;
+        Uint32 index = currentTime & SLOT_MASK;
+
+        // Level 0 wrapped around: pull the next block down from the upper levels
+        if (index == 0) {
+            for (int level = 1; level < LEVELS; level++) {
+                cascade(level);
+                if (((currentTime >> (SLOT_BITS * level)) & SLOT_MASK) != 0) break;
+            }
+        }
+
+        if (!slots[0][index].empty()) {
+            std::vector<SlotEntry> due;
+            due.swap(slots[0][index]);
+            fire(due);
+        }
+
+        // Timers scheduled by callbacks for "right now" fire in the same tick
+        while (!overdue.empty()) {
+            std::vector<SlotEntry> due;
+            due.swap(overdue);
+            fire(due);
+        }
+    }
+}
+
+void TimerWheel::clear() {
+    for (int level = 0; level < LEVELS; level++) {
+        for (int slot = 0; slot < SLOTS; slot++) {
+            slots[level][slot].clear();
+        }
+    }
+    overdue.clear();
+    for (Uint32 i = 0; i < timers.size(); i++) {
+        if (timers[i].active) release(i);
+    }
+    started = false;
+}
+
+void TimerWheel::insert(Uint32 index) {
+    const Timer& timer = timers[index];
+    SlotEntry entry = { index, timer.generation };
+
+    if (timer.expiry <= currentTime) {
+        overdue.push_back(entry);
+        return;
+    }
+
+    Uint32 delta = timer.expiry - currentTime;
+    for (int level = 0; level < LEVELS; level++) {
+        if (delta < (1u << (SLOT_BITS * (level + 1)))) {
+            Uint32 slot = (timer.expiry >> (SLOT_BITS * level)) & SLOT_MASK;
+            slots[level][slot].push_back(entry);
+            return;
+        }
+    }
+
+    // Further out than the wheel covers (~4.6 hours): park it in the last slot
+    // of the top level, it gets re-inserted when that slot cascades
+    Uint32 maxExpiry = currentTime + (1u << (SLOT_BITS * LEVELS)) - 1;
+    Uint32 slot = (maxExpiry >> (SLOT_BITS * (LEVELS - 1))) & SLOT_MASK;
+    slots[LEVELS - 1][slot].push_back(entry);
+}
+
+void TimerWheel::cascade(int level) {
+    Uint32 slot = (currentTime >> (SLOT_BITS * level)) & SLOT_MASK;
+    if (slots[level][slot].empty()) return;
+
+    std::vector<SlotEntry> entries;
+    entries.swap(slots[level][slot]);
+    for (const SlotEntry& entry : entries) {
+        const Timer& timer = timers[entry.index];
+        if (timer.active && timer.generation == entry.generation) {
+            insert(entry.index);
+        }
+    }
+}
+
+void TimerWheel::fire(std::vector<SlotEntry>& entries) {
+    for (const SlotEntry& entry : entries) {
+        Timer& timer = timers[entry.index];
+        if (!timer.active || timer.generation != entry.generation) continue;
+
+        // Release before calling so the callback may reschedule freely
+        std::function<void()> callback = std::move(timer.callback);
+        release(entry.index);
+        if (callback) callback();
+    }
+}
+
+void TimerWheel::release(Uint32 index) {
+    Timer& timer = timers[index];
+    timer.active = false;
+    timer.generation++;
+    timer.callback = nullptr;
+    freeList.push_back(index);
+    activeCount--;
+}
+
+TimerWheel::Timer* TimerWheel::lookup(TimerId id) {
+    return const_cast<Timer*>(static_cast<const TimerWheel*>(this)->lookup(id));
+}
+
+const TimerWheel::Timer* TimerWheel::lookup(TimerId id) const {
+    if (id == INVALID_TIMER) return nullptr;
+    Uint32 index = (id & 0xFFFF) - 1;
+    Uint16 generation = static_cast<Uint16>(id >> 16);
+    if (index >= timers.size()) return nullptr;
+    const Timer& timer = timers[index];
+    if (!timer.active || timer.generation != generation) return nullptr;
+    return &timer;
+}
@@ -0,0 +1,72 @@
+#pragma once
+#include <SDL.h>
+#include <functional>
+#include <vector>
+
+// Singleton hierarchical timer wheel for gameplay timers.
+// Timers are bucketed by expiry time (4 levels of 64 slots, 1 ms resolution),
+// so advance() only touches the buckets that come due. Per-tick cost scales with
+// the number of expiring timers instead of entities x timers being polled.
+class TimerWheel {
+public:
+    typedef Uint32 TimerId;
+    static const TimerId INVALID_TIMER = 0;
+
+    static TimerWheel& getInstance();
+
+    // Fire callback once, delayMs of game time from now
+    TimerId schedule(Uint32 delayMs, std::function<void()> callback);
+    // Fire callback once at an absolute game time
+    TimerId scheduleAt(Uint32 timeMs, std::function<void()> callback);
+
+    // Cancel a pending timer and reset the handle to INVALID_TIMER
+    void cancel(TimerId& id);
+    bool isPending(TimerId id) const;
+    // Milliseconds left before a pending timer fires (0 if not pending)
+    Uint32 remaining(TimerId id) const;
+
+    // Fire every timer that expired up to nowMs (game time)
+    void advance(Uint32 nowMs);
+
+    // Drop all timers and restart the wheel at the next advance
+    void clear();
+    size_t pendingCount() const { return activeCount; }
+
+private:
+    TimerWheel();
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    static const int LEVELS = 4;
+    static const int SLOT_BITS = 6;
+    static const int SLOTS = 1 << SLOT_BITS;
+    static const Uint32 SLOT_MASK = SLOTS - 1;
+
+    struct Timer {
+        Uint32 expiry;
+        Uint16 generation;
+        bool active;
+        std::function<void()> callback;
+    };
+
+    // Slot entries carry the generation so a recycled timer is never fired twice
+    struct SlotEntry {
+        Uint32 index;
+        Uint16 generation;
+    };
+
+    void insert(Uint32 index);
+    void cascade(int level);
+    void fire(std::vector<SlotEntry>& entries);
+    void release(Uint32 index);
+    Timer* lookup(TimerId id);
+    const Timer* lookup(TimerId id) const;
+
+    std::vector<Timer> timers;
+    std::vector<Uint32> freeList;
+    std::vector<SlotEntry> slots[LEVELS][SLOTS];
+    std::vector<SlotEntry> overdue;  // scheduled at or before the current wheel time
+    Uint32 currentTime;
+    size_t activeCount;
+    bool started;
+};
@@ -1,38 +1,54 @@
 #include <SDL.h>
 #include "Game.hpp"
+#include "GameClock.h"
+#include "FramePacer.h"
+#include <cstring>
 
 #undef main  // Undefine main if it was defined by SDL
 
 /**
  * Main entry point for the Knight Fight game
- * Initializes the game, manages the main game loop and frame timing
+ * Initializes the game, manages the main game loop and frame pacing
  */
 int main(int argc, char* argv[]) {
-    // Frame rate control
-    const int FPS = 60;
-    const int frameDelay = 1000 / FPS;
-
-    Uint32 frameStart;
-    int frameTime;
+    // Frame pacing: vsync by default, --fps <rate> to cap, --uncapped to benchmark
+    FramePacer pacer;
+    pacer.configure(argc, argv);
 
     // Initialize game
     Game* game = new Game();
     game->init("Knight fight", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, 720, 576);
+    pacer.apply(Game::renderer);
+
+    // --snapshot <file>: start from a saved game state instead of a fresh run
+    for (int i = 1; i + 1 < argc; i++) {
+        if (std::strcmp(argv[i], "--snapshot") == 0) {
+            game->loadSnapshot(argv[i + 1]);
+            break;
+        }
+    }
 
     // Main game loop
+    GameClock& clock = GameClock::getInstance();
     while (game->running()) {
-        frameStart = SDL_GetTicks();
+        // Sample the frame time once; every subsystem reads it from the clock
+        clock.beginFrame();
 
-        // Game cycle: process input, update state, render
         game->handleEvents();
-        game->update();
-        game->render();
 
-        // Cap frame rate
-        frameTime = SDL_GetTicks() - frameStart;
-        if (frameDelay > frameTime) {
-            SDL_Delay(frameDelay - frameTime);
+        // Gameplay updates at a fixed 60 Hz, as many steps as the frame's time calls for;
+        // the pacer only decides how often a frame is presented
+        if (clock.isPaused()) {
+            game->update();  // Audio, loading and timers still run; game time stays frozen
+        } else {
+            while (clock.step()) {
+                game->update();
+            }
         }
+        game->render();
+
+        // Wait out the rest of the frame
+        pacer.endFrame();
     }
 
     // Clean up resources
@@ -0,0 +1,124 @@
+// Builds the asset pack (data.pak) from asset directories
+//
+// Usage: assetpack <output.pak> <dir>... [--store]
+//   Run from the game folder, e.g.: assetpack data.pak assets audio font
+//   --store  never compress (entries are compressed only when that saves 1/8 or more)
+
+#include "../PackFormat.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+struct PackedFile {
+    std::string name;
+    std::vector<char> data;  // As stored in the pack
+    PackFormat::PackEntry entry;
+};
+
+static bool readFile(const fs::path& path, std::vector<char>& out) {
+    std::ifstream input(path, std::ios::binary);
+    if (!input) return false;
+    out.assign(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    std::vector<std::string> directories;
+    const char* outputPath = nullptr;
+    bool store = false;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--store") == 0) store = true;
+        else if (!outputPath) outputPath = argv[i];
+        else directories.push_back(argv[i]);
+    }
+    if (!outputPath || directories.empty()) {
+        std::cerr << "Usage: assetpack <output.pak> <dir>... [--store]" << std::endl;
+        return 1;
+    }
+
+    // Collect files; names are relative paths with forward slashes, as the game asks for them
+    std::vector<PackedFile> files;
+    for (const std::string& directory : directories) {
+        std::error_code error;
+        for (fs::recursive_directory_iterator it(directory, error), end; it != end; it.increment(error)) {
+            if (error) break;
+            if (!it->is_regular_file()) continue;
+            PackedFile file;
+            file.name = it->path().generic_string();
+            if (!readFile(it->path(), file.data)) {
+                std::cerr << "Failed to read " << file.name << std::endl;
+                return 1;
+            }
+            files.push_back(std::move(file));
+        }
+        if (error) {
+            std::cerr << "Failed to scan " << directory << ": " << error.message() << std::endl;
+            return 1;
+        }
+    }
+    std::sort(files.begin(), files.end(), [](const PackedFile& a, const PackedFile& b) { return a.name < b.name; });
+
+    // Lay out the table, names, then aligned data
+    PackFormat::PackHeader header;
+    std::memcpy(header.magic, PackFormat::MAGIC, sizeof(PackFormat::MAGIC));
+    header.version = PackFormat::VERSION;
+    header.entryCount = static_cast<std::uint32_t>(files.size());
+
+    std::string names;
+    for (PackedFile& file : files) {
+        file.entry.size = file.data.size();
+        file.entry.compression = PackFormat::COMPRESSION_NONE;
+        file.entry.nameOffset = static_cast<std::uint32_t>(names.size());
+        file.entry.nameLength = static_cast<std::uint32_t>(file.name.size());
+        file.entry.reserved = 0;
+        names += file.name;
+
+        std::vector<char> compressed;
+        if (!store && PackFormat::compressLz4(file.data.data(), file.data.size(), compressed) &&
+            compressed.size() <= file.data.size() - file.data.size() / 8) {
+            file.data.swap(compressed);
+            file.entry.compression = PackFormat::COMPRESSION_LZ4;
+        }
+        file.entry.storedSize = file.data.size();
+    }
+    header.nameTableSize = static_cast<std::uint32_t>(names.size());
+
+    std::uint64_t offset = sizeof(header) + files.size() * sizeof(PackFormat::PackEntry) + names.size();
+    for (PackedFile& file : files) {
+        offset = (offset + PackFormat::DATA_ALIGNMENT - 1) / PackFormat::DATA_ALIGNMENT * PackFormat::DATA_ALIGNMENT;
+        file.entry.offset = offset;
+        offset += file.entry.storedSize;
+    }
+
+    std::ofstream output(outputPath, std::ios::binary);
+    output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (const PackedFile& file : files) {
+        output.write(reinterpret_cast<const char*>(&file.entry), sizeof(file.entry));
+    }
+    output.write(names.data(), static_cast<std::streamsize>(names.size()));
+
+    std::uint64_t original = 0;
+    for (const PackedFile& file : files) {
+        std::uint64_t position = static_cast<std::uint64_t>(output.tellp());
+        std::vector<char> padding(static_cast<size_t>(file.entry.offset - position), 0);
+        output.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+        output.write(file.data.data(), static_cast<std::streamsize>(file.data.size()));
+        original += file.entry.size;
+        std::cout << (file.entry.compression == PackFormat::COMPRESSION_LZ4 ? "  lz4    " : "  stored ")
+                  << file.name << " (" << file.entry.size << " -> " << file.entry.storedSize << ")" << std::endl;
+    }
+    if (!output) {
+        std::cerr << "Failed to write " << outputPath << std::endl;
+        return 1;
+    }
+
+    std::cout << outputPath << ": " << files.size() << " files, " << original << " -> " << offset << " bytes" << std::endl;
+    return 0;
+}
@@ -0,0 +1,57 @@
+// Converts text levels (.map) to the binary level format (.lvl)
+//
+// Usage: mapconv <input.map> <output.lvl> [--raw]
+//   --raw  store raw tile ids instead of runs
+
+#include "../LevelFormat.h"
+#include "../MappedFile.h"
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::cerr << "Usage: mapconv <input.map> <output.lvl> [--raw]" << std::endl;
+        return 1;
+    }
+    const char* inputPath = argv[1];
+    const char* outputPath = argv[2];
+    bool forceRaw = argc > 3 && std::strcmp(argv[3], "--raw") == 0;
+
+    MappedFile input;
+    if (!input.open(inputPath)) return 1;
+
+    int rows = 0, cols = 0;
+    std::vector<int> tiles;
+    if (!LevelFormat::parseText(input.getData(), input.getSize(), rows, cols, tiles)) {
+        std::cerr << "Failed to parse " << inputPath << std::endl;
+        return 1;
+    }
+
+    std::vector<char> encoded;
+    if (!LevelFormat::encodeBinary(rows, cols, tiles, forceRaw, encoded)) {
+        std::cerr << "Failed to encode " << inputPath << std::endl;
+        return 1;
+    }
+
+    // Decode again so a bad conversion never ships
+    int checkRows = 0, checkCols = 0;
+    std::vector<int> checkTiles;
+    if (!LevelFormat::decodeBinary(encoded.data(), encoded.size(), checkRows, checkCols, checkTiles) ||
+        checkRows != rows || checkCols != cols || checkTiles != tiles) {
+        std::cerr << "Round trip check failed for " << inputPath << std::endl;
+        return 1;
+    }
+
+    std::ofstream output(outputPath, std::ios::binary);
+    output.write(encoded.data(), static_cast<std::streamsize>(encoded.size()));
+    if (!output) {
+        std::cerr << "Failed to write " << outputPath << std::endl;
+        return 1;
+    }
+
+    std::cout << inputPath << " (" << rows << "x" << cols << ", " << input.getSize() << " bytes) -> "
+              << outputPath << " (" << encoded.size() << " bytes)" << std::endl;
+    return 0;
+}
@@ -0,0 +1,79 @@
+// Converts a telemetry log (telemetry.log) to CSV, one row per event
+//
+// Usage: telemetry2csv <telemetry.log> [output.csv]
+//   Writes to standard output when no output file is given.
+//   Columns: session, time_ms, event, frame_time_us, value, x, y
+
+#include "../PackFormat.h"
+#include "../TelemetryFormat.h"
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+using namespace TelemetryFormat;
+
+int main(int argc, char* argv[]) {
+    if (argc < 2 || argc > 3) {
+        std::cerr << "Usage: telemetry2csv <telemetry.log> [output.csv]" << std::endl;
+        return 1;
+    }
+
+    std::ifstream input(argv[1], std::ios::binary);
+    TelemetryFileHeader header;
+    if (!input.read(reinterpret_cast<char*>(&header), sizeof(header))
+        || std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION) {
+        std::cerr << argv[1] << " is not a telemetry log (or is from another version)" << std::endl;
+        return 1;
+    }
+
+    std::ofstream file;
+    if (argc == 3) {
+        file.open(argv[2], std::ios::trunc);
+        if (!file) {
+            std::cerr << "Failed to create " << argv[2] << std::endl;
+            return 1;
+        }
+    }
+    std::ostream& output = argc == 3 ? file : std::cout;
+    output << "session,time_ms,event,frame_time_us,value,x,y\n";
+
+    int session = 0;
+    size_t rows = 0;
+    std::vector<char> stored;
+    std::vector<TelemetryRecord> records;
+    TelemetryBlockHeader block;
+    while (input.read(reinterpret_cast<char*>(&block), sizeof(block))) {
+        size_t rawSize = size_t(block.recordCount) * sizeof(TelemetryRecord);
+        stored.resize(block.storedSize);
+        records.resize(block.recordCount);
+        if (!input.read(stored.data(), block.storedSize)) {
+            // The game was killed halfway through a write; everything before it is intact
+            std::cerr << "Truncated block at the end of the log, skipped" << std::endl;
+            break;
+        }
+
+        bool valid;
+        if (block.compression == PackFormat::COMPRESSION_LZ4) {
+            valid = PackFormat::decompressLz4(stored.data(), stored.size(), reinterpret_cast<char*>(records.data()), rawSize);
+        } else {
+            valid = block.compression == PackFormat::COMPRESSION_NONE && block.storedSize == rawSize;
+            if (valid) std::memcpy(records.data(), stored.data(), rawSize);
+        }
+        if (!valid) {
+            std::cerr << "Corrupt block in the log, stopping" << std::endl;
+            break;
+        }
+
+        for (const TelemetryRecord& record : records) {
+            if (record.type == EVENT_SESSION_START) session++;
+            const char* name = record.type < EVENT_COUNT ? EVENT_NAMES[record.type] : "unknown";
+            output << session << ',' << record.time << ',' << name << ',' << record.frameTime << ','
+                   << record.value << ',' << record.x << ',' << record.y << '\n';
+            rows++;
+        }
+    }
+
+    std::cerr << "Wrote " << rows << " events from " << session << " sessions" << std::endl;
+    return 0;
+}